@@ -0,0 +1,104 @@
+// Microbenchmark of the batched RGB/HSV conversions in util_color_batch.h
+// Times each level this CPU supports, starting with SCALAR, and reports the largest difference from the scalar result
+// Build with 'make color_batch_benchmark'
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "util_color_batch.h"
+#include "util_enum.h"
+#include "util_vector.h"
+
+static const char* get_level_name(const cse::SimdLevel level)
+{
+	switch (level) {
+	case cse::SimdLevel::SCALAR:
+		return "scalar";
+	case cse::SimdLevel::SSE2:
+		return "sse2";
+	case cse::SimdLevel::AVX:
+		return "avx";
+	}
+	return "unknown";
+}
+
+static float get_max_difference(const cse::ColorBuffer& a, const cse::ColorBuffer& b)
+{
+	float result = 0.0f;
+	for (std::size_t i = 0; i < a.size(); i++) {
+		result = std::max(result, std::abs(a.x()[i] - b.x()[i]));
+		result = std::max(result, std::abs(a.y()[i] - b.y()[i]));
+		result = std::max(result, std::abs(a.z()[i] - b.z()[i]));
+	}
+	return result;
+}
+
+int main(const int argc, const char* const argv[])
+{
+	const std::size_t color_count = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 4096;
+	const int iterations = (argc > 2) ? std::atoi(argv[2]) : 200;
+	if (color_count == 0 || iterations <= 0) {
+		std::printf("usage: color_batch_benchmark [color_count] [iterations]\n");
+		return 1;
+	}
+
+	// Fixed pseudo-random colors so runs are comparable, every 16th color is gray to cover the no hue case
+	cse::ColorBuffer rgb_in(color_count);
+	std::uint32_t seed = 12345;
+	auto next_value = [&seed]() -> float
+	{
+		seed = seed * 1664525u + 1013904223u;
+		return static_cast<float>(seed >> 8) / static_cast<float>(1 << 24);
+	};
+	for (std::size_t i = 0; i < color_count; i++) {
+		if (i % 16 == 0) {
+			const float gray = next_value();
+			rgb_in.set(i, cse::Float3(gray, gray, gray));
+		}
+		else {
+			rgb_in.set(i, cse::Float3(next_value(), next_value(), next_value()));
+		}
+	}
+
+	cse::ColorBuffer hsv_expected(color_count);
+	cse::ColorBuffer rgb_expected(color_count);
+	cse::rgb_as_hsv(rgb_in, hsv_expected, cse::SimdLevel::SCALAR);
+	cse::hsv_as_rgb(hsv_expected, rgb_expected, cse::SimdLevel::SCALAR);
+
+	std::printf("%zu colors, %d iterations\n", color_count, iterations);
+	std::printf("%-8s %16s %16s %12s\n", "level", "rgb->hsv ns/col", "hsv->rgb ns/col", "max error");
+
+	const cse::SimdLevel all_levels[] = { cse::SimdLevel::SCALAR, cse::SimdLevel::SSE2, cse::SimdLevel::AVX };
+	for (const cse::SimdLevel this_level : all_levels) {
+		if (this_level > cse::get_simd_level()) {
+			break;
+		}
+
+		cse::ColorBuffer hsv_out(color_count);
+		cse::ColorBuffer rgb_out(color_count);
+
+		typedef std::chrono::steady_clock clock;
+		const clock::time_point hsv_begin = clock::now();
+		for (int i = 0; i < iterations; i++) {
+			cse::rgb_as_hsv(rgb_in, hsv_out, this_level);
+		}
+		const clock::time_point hsv_end = clock::now();
+		for (int i = 0; i < iterations; i++) {
+			cse::hsv_as_rgb(hsv_expected, rgb_out, this_level);
+		}
+		const clock::time_point rgb_end = clock::now();
+
+		const double total_colors = static_cast<double>(color_count) * iterations;
+		const double hsv_ns = std::chrono::duration<double, std::nano>(hsv_end - hsv_begin).count() / total_colors;
+		const double rgb_ns = std::chrono::duration<double, std::nano>(rgb_end - hsv_end).count() / total_colors;
+		const float max_error = std::max(get_max_difference(hsv_out, hsv_expected), get_max_difference(rgb_out, rgb_expected));
+		std::printf("%-8s %16.3f %16.3f %12g\n", get_level_name(this_level), hsv_ns, rgb_ns, max_error);
+	}
+
+	return 0;
+}
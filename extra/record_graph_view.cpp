@@ -0,0 +1,149 @@
+// Headless measurement of the graph view's draw stream
+// Fills a graph with one node of every type plus a chain of connected shaders, then draws it through NvgRecordingContext
+// and prints what NanoVG would have submitted, no GPU or window is needed
+// Build with 'make record_graph_view'
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include <nanovg.h>
+
+#include "editable_graph.h"
+#include "node_base.h"
+#include "node_registry.h"
+#include "output.h"
+#include "sockets.h"
+#include "subwindow_node_list.h"
+#include "ui_requests.h"
+#include "util_enum.h"
+#include "util_vector.h"
+#include "view.h"
+#include "wrapper_nvg_recording_context.h"
+
+static constexpr int VIEW_WIDTH = 1920;
+static constexpr int VIEW_HEIGHT = 1080;
+
+static void populate_graph(cse::EditableGraph& graph, const int chain_length)
+{
+	// A new material graph holds only its output node
+	const std::shared_ptr<cse::EditableNode> output_node = graph.nodes.front();
+
+	// One of every node in the node list, laid out in a grid left of the origin
+	const int GRID_COLUMNS = 12;
+	int grid_index = 0;
+	for (std::size_t i = 0; i < cse::get_node_type_count(); i++) {
+		const cse::NodeTypeInfo* const info = cse::get_node_type_info(static_cast<cse::CyclesNodeType>(i));
+		if (info == nullptr || info->in_node_list == false) {
+			continue;
+		}
+		const cse::Float2 position(-3000.0f + 220.0f * (grid_index % GRID_COLUMNS), -1800.0f + 450.0f * (grid_index / GRID_COLUMNS));
+		std::shared_ptr<cse::EditableNode> node = info->create(position);
+		graph.add_node(node, position);
+		grid_index++;
+	}
+
+	// Diffuse shaders mixed together one at a time, ending at the material output
+	std::shared_ptr<cse::EditableNode> previous_mix;
+	for (int i = 0; i < chain_length; i++) {
+		const cse::Float2 diffuse_position(-200.0f + 400.0f * i, 200.0f);
+		const cse::Float2 mix_position(0.0f + 400.0f * i, 0.0f);
+		std::shared_ptr<cse::EditableNode> diffuse = cse::create_node(cse::CyclesNodeType::DiffuseBSDF, diffuse_position);
+		std::shared_ptr<cse::EditableNode> mix = cse::create_node(cse::CyclesNodeType::MixShader, mix_position);
+		graph.add_node(diffuse, diffuse_position);
+		graph.add_node(mix, mix_position);
+
+		graph.add_connection(diffuse->get_socket_by_internal_name(cse::SocketIOType::OUTPUT, "BSDF"), mix->get_socket_by_internal_name(cse::SocketIOType::INPUT, "closure1"));
+		if (previous_mix) {
+			graph.add_connection(previous_mix->get_socket_by_internal_name(cse::SocketIOType::OUTPUT, "closure"), mix->get_socket_by_internal_name(cse::SocketIOType::INPUT, "closure2"));
+		}
+		previous_mix = mix;
+	}
+
+	if (previous_mix) {
+		output_node->world_pos = cse::Float2(400.0f * chain_length, 0.0f);
+		graph.add_connection(previous_mix->get_socket_by_internal_name(cse::SocketIOType::OUTPUT, "closure"), output_node->get_socket_by_internal_name(cse::SocketIOType::INPUT, "surface"));
+	}
+}
+
+static void draw_frame(cse::EditGraphView& view, const cse::NvgRecordingContext& recording)
+{
+	view.pre_draw();
+	view.prepare_draw(recording.context_ptr, 1.0f);
+	nvgBeginFrame(recording.context_ptr, static_cast<float>(VIEW_WIDTH), static_cast<float>(VIEW_HEIGHT), 1.0f);
+	nvgSave(recording.context_ptr);
+	view.draw(recording.context_ptr);
+	nvgRestore(recording.context_ptr);
+	nvgEndFrame(recording.context_ptr);
+}
+
+static void print_stats(const char* const label, const cse::NvgRecordingStats& stats)
+{
+	const int frames = (stats.frames > 0) ? stats.frames : 1;
+	std::printf("  %-6s %6d frames, per frame: %7.1f fills %7.1f strokes %7.1f text runs %8.1f paths %9.1f vertices %6.2f texture updates\n",
+		label,
+		stats.frames,
+		static_cast<double>(stats.fills) / frames,
+		static_cast<double>(stats.strokes) / frames,
+		static_cast<double>(stats.text_runs) / frames,
+		static_cast<double>(stats.paths) / frames,
+		static_cast<double>(stats.vertices) / frames,
+		static_cast<double>(stats.texture_updates) / frames);
+}
+
+int main(const int argc, const char* const argv[])
+{
+	const char* const font_path = (argc > 1) ? argv[1] : "./font/SourceSansPro-Regular.ttf";
+	const int chain_length = (argc > 2) ? std::atoi(argv[2]) : 8;
+	const int frames = (argc > 3) ? std::atoi(argv[3]) : 60;
+	if (chain_length < 0 || frames <= 0) {
+		std::printf("usage: record_graph_view [font_path] [chain_length] [frames]\n");
+		return 1;
+	}
+
+	cse::NvgRecordingContext recording;
+	if (recording.is_valid() == false) {
+		std::printf("failed to create recording context\n");
+		return 1;
+	}
+	if (nvgCreateFont(recording.context_ptr, "sans", font_path) < 0) {
+		std::printf("failed to load font: %s\n", font_path);
+		return 1;
+	}
+
+	const auto graph = std::make_shared<cse::EditableGraph>(cse::ShaderGraphType::MATERIAL);
+	populate_graph(*graph, chain_length);
+	const auto node_creation_helper = std::make_shared<cse::NodeCreationHelper>();
+
+	cse::EditGraphView view(graph, node_creation_helper);
+	view.set_mouse_position(cse::Float2(VIEW_WIDTH / 2.0f, VIEW_HEIGHT / 2.0f), VIEW_WIDTH, VIEW_HEIGHT);
+
+	std::printf("%zu nodes, %zu connections, %dx%d view\n", graph->nodes.size(), graph->connections.size(), VIEW_WIDTH, VIEW_HEIGHT);
+
+	// Default zoom, then zoomed out far enough for the reduced detail levels to be used
+	const int zoom_out_steps[] = { 0, 3, 3 };
+	for (const int this_steps : zoom_out_steps) {
+		cse::ViewUIRequests requests;
+		for (int i = 0; i < this_steps; i++) {
+			requests.zoom_out = true;
+			view.handle_requests(requests);
+		}
+
+		std::printf("%s\n", view.get_zoom_string().c_str());
+
+		// The first frame fills the font atlas and records display lists, later frames show the steady state
+		recording.clear();
+		draw_frame(view, recording);
+		print_stats("first", recording.get_stats());
+		std::printf("  %s\n", view.get_draw_counts_string().c_str());
+
+		recording.clear();
+		for (int i = 0; i < frames; i++) {
+			draw_frame(view, recording);
+		}
+		print_stats("steady", recording.get_stats());
+		std::printf("  %s\n", view.get_draw_counts_string().c_str());
+	}
+
+	return 0;
+}
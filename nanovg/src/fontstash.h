@@ -24,6 +24,9 @@
 enum FONSflags {
 	FONS_ZERO_TOPLEFT = 1,
 	FONS_ZERO_BOTTOMLEFT = 2,
+	// Glyphs are rasterized once at FONS_SDF_SIZE and stored as signed distance fields,
+	// the renderer is expected to threshold them at 0.5.
+	FONS_SDF = 4,
 };
 
 enum FONSalign {
@@ -101,6 +104,15 @@ int fonsExpandAtlas(FONScontext* s, int width, int height);
 // Resets the whole stash.
 int fonsResetAtlas(FONScontext* stash, int width, int height);
 
+// Glyph cache serialization, stores the atlas texture, packing state and cached glyphs of every font.
+// A cache can only be loaded into a stash built the same way with the same fonts added in the same order.
+// Returns the number of bytes needed to save the cache.
+int fonsGlyphCacheSize(FONScontext* s);
+// Returns the number of bytes written, or 0 if the buffer is too small.
+int fonsSaveGlyphCache(FONScontext* s, unsigned char* data, int ndata);
+// Returns 1 on success, 0 if the data does not match this stash or is corrupt. On failure the cached glyphs and atlas are left as they were.
+int fonsLoadGlyphCache(FONScontext* s, const unsigned char* data, int ndata);
+
 // Add fonts
 int fonsAddFont(FONScontext* s, const char* name, const char* path);
 #ifdef _WIN32
@@ -146,6 +158,8 @@ void fonsDrawDebug(FONScontext* s, float x, float y);
 
 #ifdef FONTSTASH_IMPLEMENTATION
 
+#include <limits.h>
+
 #define FONS_NOTUSED(v)  (void)sizeof(v)
 
 #ifdef FONS_USE_FREETYPE
@@ -328,6 +342,12 @@ int fons__tt_getGlyphKernAdvance(FONSttFontImpl *font, int glyph1, int glyph2)
 
 #endif
 
+#ifndef FONS_SDF_SIZE
+#	define FONS_SDF_SIZE 48
+#endif
+#ifndef FONS_SDF_PAD
+#	define FONS_SDF_PAD 6
+#endif
 #ifndef FONS_SCRATCH_BUF_SIZE
 #	define FONS_SCRATCH_BUF_SIZE 96000
 #endif
@@ -1063,6 +1083,48 @@ static void fons__blurRows(unsigned char* dst, int w, int h, int dstStride, int
 }
 
 
+// Converts a coverage bitmap to a signed distance field in place.
+// Distances are measured in pixels to the nearest texel on the other side of the edge, searched up to 'pad'.
+// 128 is the edge, values fall off by 127/pad per pixel on either side.
+static void fons__sdf(FONScontext* stash, unsigned char* dst, int w, int h, int dstStride, int pad)
+{
+	int x, y, sx, sy;
+	unsigned char* src;
+
+	stash->nscratch = 0;
+	src = (unsigned char*)fons__tmpalloc(w*h, stash);
+	if (src == NULL) return;
+	for (y = 0; y < h; y++)
+		memcpy(&src[y*w], &dst[y*dstStride], w);
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			const unsigned char cov = src[x + y*w];
+			const int inside = cov >= 128;
+			float dist, best = (float)(pad*pad);
+			int v;
+			if (cov > 0 && cov < 255) {
+				// Partially covered texels sit on the edge, use the coverage directly
+				dist = cov/255.0f - 0.5f;
+			} else {
+				for (sy = fons__maxi(y-pad, 0); sy <= fons__mini(y+pad, h-1); sy++) {
+					for (sx = fons__maxi(x-pad, 0); sx <= fons__mini(x+pad, w-1); sx++) {
+						if ((src[sx + sy*w] >= 128) != inside) {
+							const float d2 = (float)((sx-x)*(sx-x) + (sy-y)*(sy-y));
+							if (d2 < best) best = d2;
+						}
+					}
+				}
+				dist = sqrtf(best) - 0.5f;
+				if (!inside) dist = -dist;
+			}
+			v = 128 + (int)(dist * 127.0f / pad);
+			dst[x + y*dstStride] = (unsigned char)fons__maxi(0, fons__mini(255, v));
+		}
+	}
+	stash->nscratch = 0;
+}
+
 static void fons__blur(FONScontext* stash, unsigned char* dst, int w, int h, int dstStride, int blur)
 {
 	int alpha;
@@ -1098,6 +1160,13 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 	if (isize < 2) return NULL;
 	if (iblur > 20) iblur = 20;
 	pad = iblur+2;
+	if (stash->params.flags & FONS_SDF) {
+		// Every requested size shares one distance field, fons__getQuad scales it to the requested size
+		isize = FONS_SDF_SIZE*10;
+		size = (float)FONS_SDF_SIZE;
+		iblur = 0;
+		pad = FONS_SDF_PAD;
+	}
 
 	// Reset allocator.
 	stash->nscratch = 0;
@@ -1204,6 +1273,11 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 		}
 	}*/
 
+	if (stash->params.flags & FONS_SDF) {
+		bdst = &stash->texData[glyph->x0 + glyph->y0 * stash->params.width];
+		fons__sdf(stash, bdst, gw, gh, stash->params.width, pad);
+	}
+
 	// Blur
 	if (iblur > 0) {
 		stash->nscratch = 0;
@@ -1219,12 +1293,75 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 	return glyph;
 }
 
+// Distance field glyphs are stored at FONS_SDF_SIZE, scale the quad down to the requested size.
+// Positions are not snapped to whole pixels because the field stays sharp at fractional offsets.
+static void fons__getQuadSDF(FONScontext* stash, FONSfont* font,
+						   int prevGlyphIndex, FONSglyph* glyph,
+						   float scale, float spacing, float* x, float* y, FONSquad* q)
+{
+	float ratio, xoff, yoff, x0, y0, x1, y1;
+
+	if (prevGlyphIndex != -1) {
+		float adv = fons__tt_getGlyphKernAdvance(&font->font, prevGlyphIndex, glyph->index) * scale;
+		*x += adv + spacing;
+	}
+
+	ratio = scale / fons__tt_getPixelHeightScale(&font->font, (float)FONS_SDF_SIZE);
+
+	// Same one pixel inset as regular glyphs
+	xoff = (float)(glyph->xoff+1) * ratio;
+	yoff = (float)(glyph->yoff+1) * ratio;
+	x0 = (float)(glyph->x0+1);
+	y0 = (float)(glyph->y0+1);
+	x1 = (float)(glyph->x1-1);
+	y1 = (float)(glyph->y1-1);
+
+	q->x0 = *x + xoff;
+	q->x1 = q->x0 + (x1 - x0) * ratio;
+	if (stash->params.flags & FONS_ZERO_TOPLEFT) {
+		q->y0 = *y + yoff;
+		q->y1 = q->y0 + (y1 - y0) * ratio;
+	} else {
+		q->y0 = *y - yoff;
+		q->y1 = q->y0 - (y1 - y0) * ratio;
+	}
+
+	q->s0 = x0 * stash->itw;
+	q->t0 = y0 * stash->ith;
+	q->s1 = x1 * stash->itw;
+	q->t1 = y1 * stash->ith;
+
+	*x += glyph->xadv / 10.0f * ratio;
+}
+
+// Distance field quads keep the whole distance field around the glyph so the edge can fade out.
+// Measuring uses the glyph box plus the same one pixel border as a regular glyph quad instead.
+static void fons__getQuadBoundsSDF(FONScontext* stash, FONSfont* font, float scale, FONSquad* q)
+{
+	float ratio = scale / fons__tt_getPixelHeightScale(&font->font, (float)FONS_SDF_SIZE);
+	float inset = (float)(FONS_SDF_PAD-1) * ratio - 1.0f;
+	q->x0 += inset;
+	q->x1 -= inset;
+	if (stash->params.flags & FONS_ZERO_TOPLEFT) {
+		q->y0 += inset;
+		q->y1 -= inset;
+	} else {
+		q->y0 -= inset;
+		q->y1 += inset;
+	}
+}
+
 static void fons__getQuad(FONScontext* stash, FONSfont* font,
 						   int prevGlyphIndex, FONSglyph* glyph,
 						   float scale, float spacing, float* x, float* y, FONSquad* q)
 {
 	float rx,ry,xoff,yoff,x0,y0,x1,y1;
 
+	if (stash->params.flags & FONS_SDF) {
+		fons__getQuadSDF(stash, font, prevGlyphIndex, glyph, scale, spacing, x, y, q);
+		return;
+	}
+
 	if (prevGlyphIndex != -1) {
 		float adv = fons__tt_getGlyphKernAdvance(&font->font, prevGlyphIndex, glyph->index) * scale;
 		*x += (int)(adv + spacing + 0.5f);
@@ -1555,6 +1692,8 @@ float fonsTextBounds(FONScontext* stash,
 		glyph = fons__getGlyph(stash, font, codepoint, isize, iblur, FONS_GLYPH_BITMAP_OPTIONAL);
 		if (glyph != NULL) {
 			fons__getQuad(stash, font, prevGlyphIndex, glyph, scale, state->spacing, &x, &y, &q);
+			if (stash->params.flags & FONS_SDF)
+				fons__getQuadBoundsSDF(stash, font, scale, &q);
 			if (q.x0 < minx) minx = q.x0;
 			if (q.x1 > maxx) maxx = q.x1;
 			if (stash->params.flags & FONS_ZERO_TOPLEFT) {
@@ -1797,5 +1936,194 @@ int fonsResetAtlas(FONScontext* stash, int width, int height)
 	return 1;
 }
 
+#define FONS_GLYPH_CACHE_MAGIC 0x43475346 // 'FSGC'
+#define FONS_GLYPH_CACHE_VERSION 1
+
+// Everything that changes the layout or contents of the cache must be part of the header
+static void fons__glyphCacheHeader(FONScontext* stash, int* header)
+{
+	header[0] = FONS_GLYPH_CACHE_MAGIC;
+	header[1] = FONS_GLYPH_CACHE_VERSION;
+	header[2] = (int)sizeof(FONSglyph);
+	header[3] = FONS_HASH_LUT_SIZE;
+	header[4] = stash->params.flags;
+	header[5] = (stash->params.flags & FONS_SDF) ? FONS_SDF_SIZE : 0;
+	header[6] = (stash->params.flags & FONS_SDF) ? FONS_SDF_PAD : 0;
+	header[7] = stash->nfonts;
+}
+#define FONS_GLYPH_CACHE_HEADER_INTS 8
+
+int fonsGlyphCacheSize(FONScontext* stash)
+{
+	int i, size;
+	if (stash == NULL) return 0;
+	size = sizeof(int) * FONS_GLYPH_CACHE_HEADER_INTS;
+	size += sizeof(int) * 3; // width, height, nnodes
+	size += sizeof(FONSatlasNode) * stash->atlas->nnodes;
+	for (i = 0; i < stash->nfonts; i++) {
+		size += sizeof(int) * 2; // dataSize, nglyphs
+		size += sizeof(FONSglyph) * stash->fonts[i]->nglyphs;
+		size += sizeof(int) * FONS_HASH_LUT_SIZE;
+	}
+	size += stash->params.width * stash->params.height;
+	return size;
+}
+
+static unsigned char* fons__writeBytes(unsigned char* dst, const void* src, int n)
+{
+	memcpy(dst, src, n);
+	return dst + n;
+}
+
+int fonsSaveGlyphCache(FONScontext* stash, unsigned char* data, int ndata)
+{
+	int i, size, header[FONS_GLYPH_CACHE_HEADER_INTS];
+	unsigned char* dst = data;
+	if (stash == NULL || data == NULL) return 0;
+	size = fonsGlyphCacheSize(stash);
+	if (ndata < size) return 0;
+
+	fons__glyphCacheHeader(stash, header);
+	dst = fons__writeBytes(dst, header, sizeof(header));
+	dst = fons__writeBytes(dst, &stash->params.width, sizeof(int));
+	dst = fons__writeBytes(dst, &stash->params.height, sizeof(int));
+	dst = fons__writeBytes(dst, &stash->atlas->nnodes, sizeof(int));
+	dst = fons__writeBytes(dst, stash->atlas->nodes, sizeof(FONSatlasNode) * stash->atlas->nnodes);
+	for (i = 0; i < stash->nfonts; i++) {
+		FONSfont* font = stash->fonts[i];
+		dst = fons__writeBytes(dst, &font->dataSize, sizeof(int));
+		dst = fons__writeBytes(dst, &font->nglyphs, sizeof(int));
+		dst = fons__writeBytes(dst, font->glyphs, sizeof(FONSglyph) * font->nglyphs);
+		dst = fons__writeBytes(dst, font->lut, sizeof(int) * FONS_HASH_LUT_SIZE);
+	}
+	dst = fons__writeBytes(dst, stash->texData, stash->params.width * stash->params.height);
+	return (int)(dst - data);
+}
+
+static int fons__readInt(const unsigned char** src, const unsigned char* end, int* val)
+{
+	if (end - *src < (int)sizeof(int)) return 0;
+	memcpy(val, *src, sizeof(int));
+	*src += sizeof(int);
+	return 1;
+}
+
+static int fons__validGlyphIndex(int index, int nglyphs)
+{
+	return index == -1 || (index >= 0 && index < nglyphs);
+}
+
+// Checks the saved glyphs and lookup table of one font, these are used as indices and atlas coordinates once loaded
+static int fons__validateGlyphCacheFont(const unsigned char* src, int nglyphs, int width, int height)
+{
+	int i, lut;
+	FONSglyph glyph;
+	for (i = 0; i < nglyphs; i++) {
+		memcpy(&glyph, src + sizeof(FONSglyph) * i, sizeof(FONSglyph));
+		if (!fons__validGlyphIndex(glyph.next, nglyphs)) return 0;
+		// Negative coordinates mark a glyph with no bitmap, only glyphs with one use the atlas
+		if (glyph.x0 >= 0 && glyph.y0 >= 0) {
+			if (glyph.x1 < glyph.x0 || glyph.y1 < glyph.y0) return 0;
+			if (glyph.x1 > width || glyph.y1 > height) return 0;
+		}
+	}
+	src += sizeof(FONSglyph) * nglyphs;
+	for (i = 0; i < FONS_HASH_LUT_SIZE; i++) {
+		memcpy(&lut, src + sizeof(int) * i, sizeof(int));
+		if (!fons__validGlyphIndex(lut, nglyphs)) return 0;
+	}
+	return 1;
+}
+
+int fonsLoadGlyphCache(FONScontext* stash, const unsigned char* data, int ndata)
+{
+	int i, width, height, nnodes, dataSize, nglyphs;
+	int header[FONS_GLYPH_CACHE_HEADER_INTS];
+	const unsigned char* src = data;
+	const unsigned char* end = data + ndata;
+	const unsigned char* nodesBegin;
+	const unsigned char* fontsBegin;
+	FONSatlasNode node;
+	if (stash == NULL || data == NULL) return 0;
+
+	// Validate everything before touching the stash
+	fons__glyphCacheHeader(stash, header);
+	if (ndata < (int)sizeof(header) || memcmp(src, header, sizeof(header)) != 0) return 0;
+	src += sizeof(header);
+	if (!fons__readInt(&src, end, &width) || !fons__readInt(&src, end, &height) || !fons__readInt(&src, end, &nnodes)) return 0;
+	if (width <= 0 || height <= 0 || width > SHRT_MAX || height > SHRT_MAX || nnodes < 0) return 0;
+	if (end - src < (long)sizeof(FONSatlasNode) * nnodes) return 0;
+	nodesBegin = src;
+	for (i = 0; i < nnodes; i++) {
+		// New glyphs are packed using these, so they must stay inside the atlas
+		memcpy(&node, src, sizeof(FONSatlasNode));
+		if (node.x < 0 || node.y < 0 || node.width < 0 || node.x + node.width > width || node.y > height) return 0;
+		src += sizeof(FONSatlasNode);
+	}
+	fontsBegin = src;
+	for (i = 0; i < stash->nfonts; i++) {
+		if (!fons__readInt(&src, end, &dataSize) || !fons__readInt(&src, end, &nglyphs)) return 0;
+		if (dataSize != stash->fonts[i]->dataSize || nglyphs < 0) return 0;
+		if (end - src < (long)(sizeof(FONSglyph) * nglyphs + sizeof(int) * FONS_HASH_LUT_SIZE)) return 0;
+		if (!fons__validateGlyphCacheFont(src, nglyphs, width, height)) return 0;
+		src += sizeof(FONSglyph) * nglyphs + sizeof(int) * FONS_HASH_LUT_SIZE;
+	}
+	if (end - src != (long)width * height) return 0;
+
+	// Make all allocations before the reset so a failed allocation leaves the stash as it was
+	// Growing these buffers does not change any glyphs or atlas state
+	if (nnodes > stash->atlas->cnodes) {
+		FONSatlasNode* nodes = (FONSatlasNode*)realloc(stash->atlas->nodes, sizeof(FONSatlasNode) * nnodes);
+		if (nodes == NULL) return 0;
+		stash->atlas->nodes = nodes;
+		stash->atlas->cnodes = nnodes;
+	}
+	src = fontsBegin;
+	for (i = 0; i < stash->nfonts; i++) {
+		FONSfont* font = stash->fonts[i];
+		fons__readInt(&src, end, &dataSize);
+		fons__readInt(&src, end, &nglyphs);
+		if (nglyphs > font->cglyphs) {
+			FONSglyph* glyphs = (FONSglyph*)realloc(font->glyphs, sizeof(FONSglyph) * nglyphs);
+			if (glyphs == NULL) return 0;
+			font->glyphs = glyphs;
+			font->cglyphs = nglyphs;
+		}
+		src += sizeof(FONSglyph) * nglyphs + sizeof(int) * FONS_HASH_LUT_SIZE;
+	}
+	if (width * height > stash->params.width * stash->params.height) {
+		unsigned char* texData = (unsigned char*)realloc(stash->texData, width * height);
+		if (texData == NULL) return 0;
+		stash->texData = texData;
+	}
+
+	// Resize and clear the atlas, then restore the saved state over it
+	// The texture buffer is already large enough, so the reset can only fail in the render back-end's resize, before the atlas is cleared
+	if (fonsResetAtlas(stash, width, height) == 0) return 0;
+
+	stash->atlas->nnodes = nnodes;
+	memcpy(stash->atlas->nodes, nodesBegin, sizeof(FONSatlasNode) * nnodes);
+
+	src = fontsBegin;
+	for (i = 0; i < stash->nfonts; i++) {
+		FONSfont* font = stash->fonts[i];
+		fons__readInt(&src, end, &dataSize);
+		fons__readInt(&src, end, &nglyphs);
+		font->nglyphs = nglyphs;
+		memcpy(font->glyphs, src, sizeof(FONSglyph) * nglyphs);
+		src += sizeof(FONSglyph) * nglyphs;
+		memcpy(font->lut, src, sizeof(int) * FONS_HASH_LUT_SIZE);
+		src += sizeof(int) * FONS_HASH_LUT_SIZE;
+	}
+	memcpy(stash->texData, src, width * height);
+
+	// The whole texture needs to be uploaded
+	stash->dirtyRect[0] = 0;
+	stash->dirtyRect[1] = 0;
+	stash->dirtyRect[2] = width;
+	stash->dirtyRect[3] = height;
+
+	return 1;
+}
 
 #endif
@@ -129,6 +129,72 @@ struct NVGcontext {
 	int fillTriCount;
 	int strokeTriCount;
 	int textTriCount;
+	// Incremented whenever the font atlas is replaced, text in display lists recorded before that is invalid
+	int fontAtlasRevision;
+	NVGdisplayList* displayList;
+	// Scratch space for the translated copy of a shape being drawn
+	NVGpath* shapePaths;
+	int cshapePaths;
+	NVGvertex* shapeVerts;
+	int cshapeVerts;
+};
+
+#define NVG_DISPLAYLIST_FILL 1
+#define NVG_DISPLAYLIST_STROKE 2
+#define NVG_DISPLAYLIST_TRIANGLES 3
+
+struct NVGdisplayCall {
+	int type;
+	NVGpaint paint;
+	NVGcompositeOperationState compositeOperation;
+	NVGscissor scissor;
+	float fringe;
+	float strokeWidth;
+	float bounds[4];
+	int path;		// Fill and stroke, index of first path
+	int npaths;
+	int vert;		// Triangles, index of first vertex
+	int nverts;
+};
+typedef struct NVGdisplayCall NVGdisplayCall;
+
+struct NVGdisplayList {
+	NVGdisplayCall* calls;
+	int ncalls;
+	int ccalls;
+	NVGpath* paths;
+	// Fill and stroke vertex offsets of each path, pointers are only set once recording ends
+	int* pathVerts;
+	int npaths;
+	int cpaths;
+	int cpathVerts;
+	NVGvertex* verts;
+	int nverts;
+	int cverts;
+	float devicePxRatio;
+	int fontAtlasRevision;
+	int hasText;
+	int complete;
+	int failed;
+};
+
+struct NVGshape {
+	int type;		// NVG_DISPLAYLIST_FILL or NVG_DISPLAYLIST_STROKE, 0 while empty
+	float xform[6];
+	float devicePxRatio;
+	float fringe;
+	float strokeWidth;
+	float strokeAlpha;	// Coverage of strokes thinner than a pixel
+	float bounds[4];
+	NVGpath* paths;
+	// Fill and stroke vertex offsets of each path
+	int* pathVerts;
+	int npaths;
+	int cpaths;
+	int cpathVerts;
+	NVGvertex* verts;
+	int nverts;
+	int cverts;
 };
 
 static float nvg__sqrtf(float a) { return sqrtf(a); }
@@ -315,6 +381,8 @@ NVGcontext* nvgCreateInternal(NVGparams* params)
 	fontParams.width = NVG_INIT_FONTIMAGE_SIZE;
 	fontParams.height = NVG_INIT_FONTIMAGE_SIZE;
 	fontParams.flags = FONS_ZERO_TOPLEFT;
+	if (ctx->params.sdfText)
+		fontParams.flags |= FONS_SDF;
 	fontParams.renderCreate = NULL;
 	fontParams.renderUpdate = NULL;
 	fontParams.renderDraw = NULL;
@@ -324,7 +392,7 @@ NVGcontext* nvgCreateInternal(NVGparams* params)
 	if (ctx->fs == NULL) goto error;
 
 	// Create font texture
-	ctx->fontImages[0] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, fontParams.width, fontParams.height, 0, NULL);
+	ctx->fontImages[0] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, fontParams.width, fontParams.height, ctx->params.sdfText ? NVG_IMAGE_SDF : 0, NULL);
 	if (ctx->fontImages[0] == 0) goto error;
 	ctx->fontImageIdx = 0;
 
@@ -346,6 +414,8 @@ void nvgDeleteInternal(NVGcontext* ctx)
 	if (ctx == NULL) return;
 	if (ctx->commands != NULL) free(ctx->commands);
 	if (ctx->cache != NULL) nvg__deletePathCache(ctx->cache);
+	free(ctx->shapePaths);
+	free(ctx->shapeVerts);
 
 	if (ctx->fs)
 		fonsDeleteInternal(ctx->fs);
@@ -2216,6 +2286,109 @@ void nvgDebugDumpPathCache(NVGcontext* ctx)
 	}
 }
 
+static int nvg__displayListReserve(void** ptr, int* cap, int needed, int size)
+{
+	void* mem;
+	int ncap;
+	if (needed <= *cap) return 1;
+	ncap = nvg__maxi(needed, *cap == 0 ? 64 : *cap * 2);
+	mem = realloc(*ptr, (size_t)ncap * size);
+	if (mem == NULL) return 0;
+	*ptr = mem;
+	*cap = ncap;
+	return 1;
+}
+
+// Returns 0 if out of memory. Paths may have no fill or no stroke vertices, so a count of 0 is not a failure.
+static int nvg__displayListAllocVerts(NVGdisplayList* list, const NVGvertex* verts, int nverts, int* offset)
+{
+	if (!nvg__displayListReserve((void**)&list->verts, &list->cverts, list->nverts + nverts, sizeof(NVGvertex))) return 0;
+	*offset = list->nverts;
+	if (nverts > 0)
+		memcpy(&list->verts[list->nverts], verts, sizeof(NVGvertex) * nverts);
+	list->nverts += nverts;
+	return 1;
+}
+
+// Copies a render call and its geometry into the display list being recorded
+static void nvg__recordCall(NVGcontext* ctx, int type, const NVGpaint* paint, NVGcompositeOperationState compositeOperation,
+							const NVGscissor* scissor, float fringe, float strokeWidth, const float* bounds,
+							const NVGpath* paths, int npaths, const NVGvertex* verts, int nverts)
+{
+	NVGdisplayList* list = ctx->displayList;
+	NVGdisplayCall* call;
+	int i;
+	if (list == NULL || list->failed) return;
+
+	if (!nvg__displayListReserve((void**)&list->calls, &list->ccalls, list->ncalls + 1, sizeof(NVGdisplayCall))) {
+		list->failed = 1;
+		return;
+	}
+	call = &list->calls[list->ncalls++];
+	memset(call, 0, sizeof(NVGdisplayCall));
+	call->type = type;
+	call->paint = *paint;
+	call->compositeOperation = compositeOperation;
+	call->scissor = *scissor;
+	call->fringe = fringe;
+	call->strokeWidth = strokeWidth;
+	if (bounds != NULL)
+		memcpy(call->bounds, bounds, sizeof(call->bounds));
+
+	if (type == NVG_DISPLAYLIST_TRIANGLES) {
+		list->hasText = 1;
+		call->nverts = nverts;
+		if (!nvg__displayListAllocVerts(list, verts, nverts, &call->vert))
+			list->failed = 1;
+		return;
+	}
+
+	if (!nvg__displayListReserve((void**)&list->paths, &list->cpaths, list->npaths + npaths, sizeof(NVGpath)) ||
+		!nvg__displayListReserve((void**)&list->pathVerts, &list->cpathVerts, list->npaths + npaths, sizeof(int) * 2)) {
+		list->failed = 1;
+		return;
+	}
+	call->path = list->npaths;
+	call->npaths = npaths;
+	for (i = 0; i < npaths; i++) {
+		NVGpath* dst = &list->paths[list->npaths];
+		int* dstVerts = &list->pathVerts[list->npaths * 2];
+		*dst = paths[i];
+		dst->fill = NULL;
+		dst->stroke = NULL;
+		if (!nvg__displayListAllocVerts(list, paths[i].fill, paths[i].nfill, &dstVerts[0]) ||
+			!nvg__displayListAllocVerts(list, paths[i].stroke, paths[i].nstroke, &dstVerts[1])) {
+			list->failed = 1;
+			return;
+		}
+		list->npaths++;
+	}
+}
+
+static void nvg__submitFill(NVGcontext* ctx, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, float fringe,
+							const float* bounds, const NVGpath* paths, int npaths)
+{
+	if (ctx->displayList != NULL)
+		nvg__recordCall(ctx, NVG_DISPLAYLIST_FILL, paint, compositeOperation, scissor, fringe, 0.0f, bounds, paths, npaths, NULL, 0);
+	ctx->params.renderFill(ctx->params.userPtr, paint, compositeOperation, scissor, fringe, bounds, paths, npaths);
+}
+
+static void nvg__submitStroke(NVGcontext* ctx, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, float fringe,
+							  float strokeWidth, const NVGpath* paths, int npaths)
+{
+	if (ctx->displayList != NULL)
+		nvg__recordCall(ctx, NVG_DISPLAYLIST_STROKE, paint, compositeOperation, scissor, fringe, strokeWidth, NULL, paths, npaths, NULL, 0);
+	ctx->params.renderStroke(ctx->params.userPtr, paint, compositeOperation, scissor, fringe, strokeWidth, paths, npaths);
+}
+
+static void nvg__submitTriangles(NVGcontext* ctx, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor,
+								 const NVGvertex* verts, int nverts)
+{
+	if (ctx->displayList != NULL)
+		nvg__recordCall(ctx, NVG_DISPLAYLIST_TRIANGLES, paint, compositeOperation, scissor, 0.0f, 0.0f, NULL, NULL, 0, verts, nverts);
+	ctx->params.renderTriangles(ctx->params.userPtr, paint, compositeOperation, scissor, verts, nverts);
+}
+
 void nvgFill(NVGcontext* ctx)
 {
 	NVGstate* state = nvg__getState(ctx);
@@ -2233,8 +2406,8 @@ void nvgFill(NVGcontext* ctx)
 	fillPaint.innerColor.a *= state->alpha;
 	fillPaint.outerColor.a *= state->alpha;
 
-	ctx->params.renderFill(ctx->params.userPtr, &fillPaint, state->compositeOperation, &state->scissor, ctx->fringeWidth,
-						   ctx->cache->bounds, ctx->cache->paths, ctx->cache->npaths);
+	nvg__submitFill(ctx, &fillPaint, state->compositeOperation, &state->scissor, ctx->fringeWidth,
+					ctx->cache->bounds, ctx->cache->paths, ctx->cache->npaths);
 
 	// Count triangles
 	for (i = 0; i < ctx->cache->npaths; i++) {
@@ -2275,8 +2448,8 @@ void nvgStroke(NVGcontext* ctx)
 	else
 		nvg__expandStroke(ctx, strokeWidth*0.5f, 0.0f, state->lineCap, state->lineJoin, state->miterLimit);
 
-	ctx->params.renderStroke(ctx->params.userPtr, &strokePaint, state->compositeOperation, &state->scissor, ctx->fringeWidth,
-							 strokeWidth, ctx->cache->paths, ctx->cache->npaths);
+	nvg__submitStroke(ctx, &strokePaint, state->compositeOperation, &state->scissor, ctx->fringeWidth,
+					  strokeWidth, ctx->cache->paths, ctx->cache->npaths);
 
 	// Count triangles
 	for (i = 0; i < ctx->cache->npaths; i++) {
@@ -2411,9 +2584,10 @@ static int nvg__allocTextAtlas(NVGcontext* ctx)
 			iw *= 2;
 		if (iw > NVG_MAX_FONTIMAGE_SIZE || ih > NVG_MAX_FONTIMAGE_SIZE)
 			iw = ih = NVG_MAX_FONTIMAGE_SIZE;
-		ctx->fontImages[ctx->fontImageIdx+1] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, iw, ih, 0, NULL);
+		ctx->fontImages[ctx->fontImageIdx+1] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, iw, ih, ctx->params.sdfText ? NVG_IMAGE_SDF : 0, NULL);
 	}
 	++ctx->fontImageIdx;
+	++ctx->fontAtlasRevision;
 	fonsResetAtlas(ctx->fs, iw, ih);
 	return 1;
 }
@@ -2430,12 +2604,79 @@ static void nvg__renderText(NVGcontext* ctx, NVGvertex* verts, int nverts)
 	paint.innerColor.a *= state->alpha;
 	paint.outerColor.a *= state->alpha;
 
-	ctx->params.renderTriangles(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, verts, nverts);
+	nvg__submitTriangles(ctx, &paint, state->compositeOperation, &state->scissor, verts, nverts);
 
 	ctx->drawCallCount++;
 	ctx->textTriCount += nverts/3;
 }
 
+void nvgPrewarmText(NVGcontext* ctx, const char* string, const char* end)
+{
+	NVGstate* state = nvg__getState(ctx);
+	FONStextIter iter, prevIter;
+	FONSquad q;
+	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+
+	if (end == NULL)
+		end = string + strlen(string);
+
+	if (state->fontId == FONS_INVALID) return;
+
+	fonsSetSize(ctx->fs, state->fontSize*scale);
+	fonsSetSpacing(ctx->fs, state->letterSpacing*scale);
+	fonsSetBlur(ctx->fs, state->fontBlur*scale);
+	fonsSetAlign(ctx->fs, state->textAlign);
+	fonsSetFont(ctx->fs, state->fontId);
+
+	// Same glyph lookup as nvgText(), without creating any vertices
+	fonsTextIterInit(ctx->fs, &iter, 0, 0, string, end, FONS_GLYPH_BITMAP_REQUIRED);
+	prevIter = iter;
+	while (fonsTextIterNext(ctx->fs, &iter, &q)) {
+		if (iter.prevGlyphIndex == -1) {
+			if (!nvg__allocTextAtlas(ctx))
+				break;
+			iter = prevIter;
+			fonsTextIterNext(ctx->fs, &iter, &q);
+			if (iter.prevGlyphIndex == -1)
+				break;
+		}
+		prevIter = iter;
+	}
+
+	nvg__flushTextTexture(ctx);
+}
+
+int nvgFontCacheSize(NVGcontext* ctx)
+{
+	return fonsGlyphCacheSize(ctx->fs);
+}
+
+int nvgSaveFontCache(NVGcontext* ctx, unsigned char* data, int ndata)
+{
+	return fonsSaveGlyphCache(ctx->fs, data, ndata);
+}
+
+int nvgLoadFontCache(NVGcontext* ctx, const unsigned char* data, int ndata)
+{
+	int w, h, iw, ih;
+	if (fonsLoadGlyphCache(ctx->fs, data, ndata) == 0)
+		return 0;
+	++ctx->fontAtlasRevision;
+
+	// The cached atlas may have grown past the size of the current font image
+	fonsGetAtlasSize(ctx->fs, &w, &h);
+	nvgImageSize(ctx, ctx->fontImages[ctx->fontImageIdx], &iw, &ih);
+	if (w != iw || h != ih) {
+		nvgDeleteImage(ctx, ctx->fontImages[ctx->fontImageIdx]);
+		ctx->fontImages[ctx->fontImageIdx] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, w, h, ctx->params.sdfText ? NVG_IMAGE_SDF : 0, NULL);
+		if (ctx->fontImages[ctx->fontImageIdx] == 0)
+			return 0;
+	}
+
+	nvg__flushTextTexture(ctx);
+	return 1;
+}
+
 float nvgText(NVGcontext* ctx, float x, float y, const char* string, const char* end)
 {
 	NVGstate* state = nvg__getState(ctx);
@@ -2911,3 +3152,262 @@ void nvgTextMetrics(NVGcontext* ctx, float* ascender, float* descender, float* l
 		*lineh *= invscale;
 }
 // vim: ft=c nu noet ts=4
+
+// Display lists
+
+NVGdisplayList* nvgCreateDisplayList(void)
+{
+	NVGdisplayList* list = (NVGdisplayList*)malloc(sizeof(NVGdisplayList));
+	if (list == NULL) return NULL;
+	memset(list, 0, sizeof(NVGdisplayList));
+	return list;
+}
+
+void nvgDeleteDisplayList(NVGdisplayList* list)
+{
+	if (list == NULL) return;
+	free(list->calls);
+	free(list->paths);
+	free(list->pathVerts);
+	free(list->verts);
+	free(list);
+}
+
+void nvgBeginDisplayList(NVGcontext* ctx, NVGdisplayList* list)
+{
+	if (list == NULL) return;
+	list->ncalls = 0;
+	list->npaths = 0;
+	list->nverts = 0;
+	list->devicePxRatio = ctx->devicePxRatio;
+	list->fontAtlasRevision = ctx->fontAtlasRevision;
+	list->hasText = 0;
+	list->complete = 0;
+	list->failed = 0;
+	ctx->displayList = list;
+}
+
+void nvgEndDisplayList(NVGcontext* ctx)
+{
+	NVGdisplayList* list = ctx->displayList;
+	int i;
+	if (list == NULL) return;
+	ctx->displayList = NULL;
+
+	// Glyphs recorded before the atlas was replaced point at a texture that is about to be deleted
+	if (list->hasText && list->fontAtlasRevision != ctx->fontAtlasRevision)
+		list->failed = 1;
+
+	// Vertices no longer move, so paths can point straight at them
+	for (i = 0; i < list->npaths; i++) {
+		list->paths[i].fill = &list->verts[list->pathVerts[i*2+0]];
+		list->paths[i].stroke = &list->verts[list->pathVerts[i*2+1]];
+	}
+	list->complete = 1;
+}
+
+int nvgDrawDisplayList(NVGcontext* ctx, NVGdisplayList* list)
+{
+	int i, j;
+	if (list == NULL || list->complete == 0 || list->failed) return 0;
+	if (list->devicePxRatio != ctx->devicePxRatio) return 0;
+	if (list->hasText && list->fontAtlasRevision != ctx->fontAtlasRevision) return 0;
+
+	for (i = 0; i < list->ncalls; i++) {
+		NVGdisplayCall* call = &list->calls[i];
+		const NVGpath* paths = &list->paths[call->path];
+		switch (call->type) {
+		case NVG_DISPLAYLIST_FILL:
+			nvg__submitFill(ctx, &call->paint, call->compositeOperation, &call->scissor, call->fringe, call->bounds, paths, call->npaths);
+			for (j = 0; j < call->npaths; j++) {
+				ctx->fillTriCount += paths[j].nfill-2;
+				ctx->fillTriCount += paths[j].nstroke-2;
+				ctx->drawCallCount += 2;
+			}
+			break;
+		case NVG_DISPLAYLIST_STROKE:
+			nvg__submitStroke(ctx, &call->paint, call->compositeOperation, &call->scissor, call->fringe, call->strokeWidth, paths, call->npaths);
+			for (j = 0; j < call->npaths; j++) {
+				ctx->strokeTriCount += paths[j].nstroke-2;
+				ctx->drawCallCount++;
+			}
+			break;
+		case NVG_DISPLAYLIST_TRIANGLES:
+			nvg__submitTriangles(ctx, &call->paint, call->compositeOperation, &call->scissor, &list->verts[call->vert], call->nverts);
+			ctx->drawCallCount++;
+			ctx->textTriCount += call->nverts/3;
+			break;
+		}
+	}
+	return 1;
+}
+
+// Shapes
+
+NVGshape* nvgCreateShape(void)
+{
+	NVGshape* shape = (NVGshape*)malloc(sizeof(NVGshape));
+	if (shape == NULL) return NULL;
+	memset(shape, 0, sizeof(NVGshape));
+	return shape;
+}
+
+void nvgDeleteShape(NVGshape* shape)
+{
+	if (shape == NULL) return;
+	free(shape->paths);
+	free(shape->pathVerts);
+	free(shape->verts);
+	free(shape);
+}
+
+static int nvg__shapeAllocVerts(NVGshape* shape, const NVGvertex* verts, int nverts, int* offset)
+{
+	if (!nvg__displayListReserve((void**)&shape->verts, &shape->cverts, shape->nverts + nverts, sizeof(NVGvertex))) return 0;
+	*offset = shape->nverts;
+	if (nverts > 0)
+		memcpy(&shape->verts[shape->nverts], verts, sizeof(NVGvertex) * nverts);
+	shape->nverts += nverts;
+	return 1;
+}
+
+// Copies the paths tessellated by the last expand into the shape
+static void nvg__copyToShape(NVGcontext* ctx, NVGshape* shape, int type)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpathCache* cache = ctx->cache;
+	int i;
+
+	shape->type = 0;
+	shape->npaths = 0;
+	shape->nverts = 0;
+	if (!nvg__displayListReserve((void**)&shape->paths, &shape->cpaths, cache->npaths, sizeof(NVGpath)) ||
+		!nvg__displayListReserve((void**)&shape->pathVerts, &shape->cpathVerts, cache->npaths, sizeof(int) * 2))
+		return;
+
+	for (i = 0; i < cache->npaths; i++) {
+		const NVGpath* path = &cache->paths[i];
+		int* dstVerts = &shape->pathVerts[i*2];
+		shape->paths[i] = *path;
+		shape->paths[i].fill = NULL;
+		shape->paths[i].stroke = NULL;
+		if (!nvg__shapeAllocVerts(shape, path->fill, path->nfill, &dstVerts[0]) ||
+			!nvg__shapeAllocVerts(shape, path->stroke, path->nstroke, &dstVerts[1]))
+			return;
+	}
+	shape->npaths = cache->npaths;
+	memcpy(shape->xform, state->xform, sizeof(shape->xform));
+	memcpy(shape->bounds, cache->bounds, sizeof(shape->bounds));
+	shape->devicePxRatio = ctx->devicePxRatio;
+	shape->fringe = ctx->fringeWidth;
+	shape->type = type;
+}
+
+void nvgFillToShape(NVGcontext* ctx, NVGshape* shape)
+{
+	NVGstate* state = nvg__getState(ctx);
+	int expanded;
+	if (shape == NULL) return;
+
+	nvg__flattenPaths(ctx);
+	if (ctx->params.edgeAntiAlias && state->shapeAntiAlias)
+		expanded = nvg__expandFill(ctx, ctx->fringeWidth, NVG_MITER, 2.4f);
+	else
+		expanded = nvg__expandFill(ctx, 0.0f, NVG_MITER, 2.4f);
+	if (!expanded) {
+		shape->type = 0;
+		return;
+	}
+
+	nvg__copyToShape(ctx, shape, NVG_DISPLAYLIST_FILL);
+	shape->strokeWidth = 0.0f;
+	shape->strokeAlpha = 1.0f;
+}
+
+void nvgStrokeToShape(NVGcontext* ctx, NVGshape* shape)
+{
+	NVGstate* state = nvg__getState(ctx);
+	float scale = nvg__getAverageScale(state->xform);
+	float strokeWidth = nvg__clampf(state->strokeWidth * scale, 0.0f, 200.0f);
+	float strokeAlpha = 1.0f;
+	int expanded;
+	if (shape == NULL) return;
+
+	if (strokeWidth < ctx->fringeWidth) {
+		// Same coverage emulation as nvgStroke()
+		float alpha = nvg__clampf(strokeWidth / ctx->fringeWidth, 0.0f, 1.0f);
+		strokeAlpha = alpha*alpha;
+		strokeWidth = ctx->fringeWidth;
+	}
+
+	nvg__flattenPaths(ctx);
+	if (ctx->params.edgeAntiAlias && state->shapeAntiAlias)
+		expanded = nvg__expandStroke(ctx, strokeWidth*0.5f, ctx->fringeWidth, state->lineCap, state->lineJoin, state->miterLimit);
+	else
+		expanded = nvg__expandStroke(ctx, strokeWidth*0.5f, 0.0f, state->lineCap, state->lineJoin, state->miterLimit);
+	if (!expanded) {
+		shape->type = 0;
+		return;
+	}
+
+	nvg__copyToShape(ctx, shape, NVG_DISPLAYLIST_STROKE);
+	shape->strokeWidth = strokeWidth;
+	shape->strokeAlpha = strokeAlpha;
+}
+
+int nvgDrawShape(NVGcontext* ctx, NVGshape* shape)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpaint paint;
+	float dx, dy, bounds[4];
+	int i;
+
+	if (shape == NULL || shape->type == 0) return 0;
+	if (shape->devicePxRatio != ctx->devicePxRatio) return 0;
+	for (i = 0; i < 4; i++)
+		if (shape->xform[i] != state->xform[i]) return 0;
+
+	if (!nvg__displayListReserve((void**)&ctx->shapePaths, &ctx->cshapePaths, shape->npaths, sizeof(NVGpath)) ||
+		!nvg__displayListReserve((void**)&ctx->shapeVerts, &ctx->cshapeVerts, shape->nverts, sizeof(NVGvertex)))
+		return 0;
+
+	// Only the translation differs, so the tessellated vertices just move
+	dx = state->xform[4] - shape->xform[4];
+	dy = state->xform[5] - shape->xform[5];
+	for (i = 0; i < shape->nverts; i++) {
+		ctx->shapeVerts[i] = shape->verts[i];
+		ctx->shapeVerts[i].x += dx;
+		ctx->shapeVerts[i].y += dy;
+	}
+	for (i = 0; i < shape->npaths; i++) {
+		ctx->shapePaths[i] = shape->paths[i];
+		ctx->shapePaths[i].fill = &ctx->shapeVerts[shape->pathVerts[i*2+0]];
+		ctx->shapePaths[i].stroke = &ctx->shapeVerts[shape->pathVerts[i*2+1]];
+	}
+
+	if (shape->type == NVG_DISPLAYLIST_FILL) {
+		paint = state->fill;
+		paint.innerColor.a *= state->alpha;
+		paint.outerColor.a *= state->alpha;
+		bounds[0] = shape->bounds[0] + dx;
+		bounds[1] = shape->bounds[1] + dy;
+		bounds[2] = shape->bounds[2] + dx;
+		bounds[3] = shape->bounds[3] + dy;
+		nvg__submitFill(ctx, &paint, state->compositeOperation, &state->scissor, shape->fringe, bounds, ctx->shapePaths, shape->npaths);
+		for (i = 0; i < shape->npaths; i++) {
+			ctx->fillTriCount += shape->paths[i].nfill-2;
+			ctx->fillTriCount += shape->paths[i].nstroke-2;
+			ctx->drawCallCount += 2;
+		}
+	} else {
+		paint = state->stroke;
+		paint.innerColor.a *= shape->strokeAlpha * state->alpha;
+		paint.outerColor.a *= shape->strokeAlpha * state->alpha;
+		nvg__submitStroke(ctx, &paint, state->compositeOperation, &state->scissor, shape->fringe, shape->strokeWidth, ctx->shapePaths, shape->npaths);
+		for (i = 0; i < shape->npaths; i++) {
+			ctx->strokeTriCount += shape->paths[i].nstroke-2;
+			ctx->drawCallCount++;
+		}
+	}
+	return 1;
+}
@@ -142,6 +142,7 @@ enum NVGimageFlags {
 	NVG_IMAGE_FLIPY				= 1<<3,		// Flips (inverses) image in Y direction when rendered.
 	NVG_IMAGE_PREMULTIPLIED		= 1<<4,		// Image data has premultiplied alpha.
 	NVG_IMAGE_NEAREST			= 1<<5,		// Image interpolation is Nearest instead Linear
+	NVG_IMAGE_SDF				= 1<<6,		// Alpha image holds a signed distance field, edge is at 0.5.
 };
 
 // Begin drawing a new frame
@@ -583,6 +584,18 @@ void nvgFontFaceId(NVGcontext* ctx, int font);
 // Sets the font face based on specified name of current text style.
 void nvgFontFace(NVGcontext* ctx, const char* font);
 
+// Rasterizes the glyphs of a text string with the current text style and transform without drawing anything.
+// Can be used before the first frame so the glyphs are already in the font atlas when they are first drawn.
+void nvgPrewarmText(NVGcontext* ctx, const char* string, const char* end);
+
+// Font atlas cache, see fonsSaveGlyphCache() and fonsLoadGlyphCache().
+// The cache can only be loaded into a context created with the same flags and fonts.
+int nvgFontCacheSize(NVGcontext* ctx);
+// Returns the number of bytes written, or 0 on failure.
+int nvgSaveFontCache(NVGcontext* ctx, unsigned char* data, int ndata);
+// Returns 1 on success, 0 if the cache does not match this context.
+int nvgLoadFontCache(NVGcontext* ctx, const unsigned char* data, int ndata);
+
 // Draws text string at specified location. If end is specified only the sub-string up to the end is drawn.
 float nvgText(NVGcontext* ctx, float x, float y, const char* string, const char* end);
 
@@ -615,6 +628,48 @@ void nvgTextMetrics(NVGcontext* ctx, float* ascender, float* descender, float* l
 // Words longer than the max width are slit at nearest character (i.e. no hyphenation).
 int nvgTextBreakLines(NVGcontext* ctx, const char* string, const char* end, float breakRowWidth, NVGtextRow* rows, int maxRows);
 
+//
+// Display lists
+//
+// Render calls made between nvgBeginDisplayList() and nvgEndDisplayList() are submitted as usual and are also
+// copied into the display list. nvgDrawDisplayList() submits the same calls again without building, flattening,
+// or tessellating any paths. Geometry is stored after the transform and scissor are applied, so a list should
+// only be replayed while everything it was recorded with is unchanged.
+
+typedef struct NVGdisplayList NVGdisplayList;
+
+NVGdisplayList* nvgCreateDisplayList(void);
+void nvgDeleteDisplayList(NVGdisplayList* list);
+
+// Clears the list and starts recording into it, lists can not be nested.
+void nvgBeginDisplayList(NVGcontext* ctx, NVGdisplayList* list);
+void nvgEndDisplayList(NVGcontext* ctx);
+
+// Returns 0 without drawing anything if the list is incomplete, was recorded with a different device pixel ratio,
+// or contains text and the font atlas has been replaced since it was recorded.
+int nvgDrawDisplayList(NVGcontext* ctx, NVGdisplayList* list);
+
+//
+// Shapes
+//
+// A shape holds the current path tessellated the way nvgFill() or nvgStroke() would draw it. nvgDrawShape() draws
+// it again with the current fill or stroke paint, composite operation, and scissor, moved to the current translation,
+// without flattening or expanding the path. This lets many copies of one shape be drawn with different paints.
+
+typedef struct NVGshape NVGshape;
+
+NVGshape* nvgCreateShape(void);
+void nvgDeleteShape(NVGshape* shape);
+
+// Replaces the shape with the current path as nvgFill() or nvgStroke() would draw it.
+// Stroke width, line cap, and line join are fixed when the shape is made.
+void nvgFillToShape(NVGcontext* ctx, NVGshape* shape);
+void nvgStrokeToShape(NVGcontext* ctx, NVGshape* shape);
+
+// Returns 0 without drawing anything if the shape is empty, or if the device pixel ratio or the scale and rotation of
+// the current transform differ from the ones the shape was made with.
+int nvgDrawShape(NVGcontext* ctx, NVGshape* shape);
+
 //
 // Internal Render API
 //
@@ -651,6 +706,7 @@ typedef struct NVGpath NVGpath;
 struct NVGparams {
 	void* userPtr;
 	int edgeAntiAlias;
+	int sdfText;
 	int (*renderCreate)(void* uptr);
 	int (*renderCreateTexture)(void* uptr, int type, int w, int h, int imageFlags, const unsigned char* data);
 	int (*renderDeleteTexture)(void* uptr, int image);
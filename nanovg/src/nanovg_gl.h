@@ -32,6 +32,8 @@ enum NVGcreateFlags {
 	NVG_STENCIL_STROKES	= 1<<1,
 	// Flag indicating that additional debug checks are done.
 	NVG_DEBUG 			= 1<<2,
+	// Flag indicating that glyphs are rasterized once as signed distance fields and scaled to any size.
+	NVG_SDF_TEXT		= 1<<3,
 };
 
 #if defined NANOVG_GL2_IMPLEMENTATION
@@ -51,6 +53,19 @@ enum NVGcreateFlags {
 
 #define NANOVG_GL_USE_STATE_FILTER (1)
 
+// Submission counters, accumulated over every flush since they were last reset.
+struct NVGglStats {
+	// Number of fill, stroke and triangle calls recorded by NanoVG.
+	int calls;
+	// Number of calls left after consecutive calls with the same paint, texture and blend state were merged.
+	int batches;
+	// Number of GL draw commands issued, a multi-draw counts once.
+	int drawCalls;
+	// Number of times the fragment uniforms were uploaded or rebound.
+	int uniformUploads;
+};
+typedef struct NVGglStats NVGglStats;
+
 // Creates NanoVG contexts for different OpenGL (ES) versions.
 // Flags should be combination of the create flags above.
 
@@ -62,6 +77,9 @@ void nvgDeleteGL2(NVGcontext* ctx);
 int nvglCreateImageFromHandleGL2(NVGcontext* ctx, GLuint textureId, int w, int h, int flags);
 GLuint nvglImageHandleGL2(NVGcontext* ctx, int image);
 
+void nvglGetStatsGL2(NVGcontext* ctx, NVGglStats* stats);
+void nvglResetStatsGL2(NVGcontext* ctx);
+
 #endif
 
 #if defined NANOVG_GL3
@@ -72,6 +90,9 @@ void nvgDeleteGL3(NVGcontext* ctx);
 int nvglCreateImageFromHandleGL3(NVGcontext* ctx, GLuint textureId, int w, int h, int flags);
 GLuint nvglImageHandleGL3(NVGcontext* ctx, int image);
 
+void nvglGetStatsGL3(NVGcontext* ctx, NVGglStats* stats);
+void nvglResetStatsGL3(NVGcontext* ctx);
+
 #endif
 
 #if defined NANOVG_GLES2
@@ -82,6 +103,9 @@ void nvgDeleteGLES2(NVGcontext* ctx);
 int nvglCreateImageFromHandleGLES2(NVGcontext* ctx, GLuint textureId, int w, int h, int flags);
 GLuint nvglImageHandleGLES2(NVGcontext* ctx, int image);
 
+void nvglGetStatsGLES2(NVGcontext* ctx, NVGglStats* stats);
+void nvglResetStatsGLES2(NVGcontext* ctx);
+
 #endif
 
 #if defined NANOVG_GLES3
@@ -92,6 +116,9 @@ void nvgDeleteGLES3(NVGcontext* ctx);
 int nvglCreateImageFromHandleGLES3(NVGcontext* ctx, GLuint textureId, int w, int h, int flags);
 GLuint nvglImageHandleGLES3(NVGcontext* ctx, int image);
 
+void nvglGetStatsGLES3(NVGcontext* ctx, NVGglStats* stats);
+void nvglResetStatsGLES3(NVGcontext* ctx);
+
 #endif
 
 // These are additional flags on top of NVGimageFlags.
@@ -268,6 +295,15 @@ struct GLNVGcontext {
 	GLuint stencilFuncMask;
 	GLNVGblend blendFunc;
 	#endif
+	// Offset of the uniforms currently bound, -1 if none are
+	int boundUniformOffset;
+
+	// Scratch arrays for multi-draw submission
+	GLint* drawFirsts;
+	GLsizei* drawCounts;
+	int cdraws;
+
+	NVGglStats stats;
 };
 typedef struct GLNVGcontext GLNVGcontext;
 
@@ -614,6 +650,15 @@ static int glnvg__renderCreate(void* uptr)
 		"	sc = vec2(0.5,0.5) - sc * scissorScale;\n"
 		"	return clamp(sc.x,0.0,1.0) * clamp(sc.y,0.0,1.0);\n"
 		"}\n"
+		"// Distance field - edge at 0.5, smoothed over one screen pixel\n"
+		"float sdfAlpha(float d) {\n"
+		"#if defined(GL_ES) && __VERSION__ < 300 && !defined(GL_OES_standard_derivatives)\n"
+		"	float w = 0.05;\n"
+		"#else\n"
+		"	float w = max(fwidth(d) * 0.5, 0.001);\n"
+		"#endif\n"
+		"	return smoothstep(0.5 - w, 0.5 + w, d);\n"
+		"}\n"
 		"#ifdef EDGE_AA\n"
 		"// Stroke - from [0..1] to clipped pyramid, where the slope is 1px.\n"
 		"float strokeMask() {\n"
@@ -648,6 +693,7 @@ static int glnvg__renderCreate(void* uptr)
 		"#endif\n"
 		"		if (texType == 1) color = vec4(color.xyz*color.w,color.w);"
 		"		if (texType == 2) color = vec4(color.x);"
+		"		if (texType == 3) color = vec4(sdfAlpha(color.x));"
 		"		// Apply color tint and alpha.\n"
 		"		color *= innerCol;\n"
 		"		// Combine alpha\n"
@@ -663,6 +709,7 @@ static int glnvg__renderCreate(void* uptr)
 		"#endif\n"
 		"		if (texType == 1) color = vec4(color.xyz*color.w,color.w);"
 		"		if (texType == 2) color = vec4(color.x);"
+		"		if (texType == 3) color = vec4(sdfAlpha(color.x));"
 		"		color *= scissor;\n"
 		"		result = color * innerCol;\n"
 		"	}\n"
@@ -949,12 +996,12 @@ static int glnvg__convertPaint(GLNVGcontext* gl, GLNVGfragUniforms* frag, NVGpai
 		if (tex->type == NVG_TEXTURE_RGBA)
 			frag->texType = (tex->flags & NVG_IMAGE_PREMULTIPLIED) ? 0 : 1;
 		else
-			frag->texType = 2;
+			frag->texType = (tex->flags & NVG_IMAGE_SDF) ? 3 : 2;
 		#else
 		if (tex->type == NVG_TEXTURE_RGBA)
 			frag->texType = (tex->flags & NVG_IMAGE_PREMULTIPLIED) ? 0.0f : 1.0f;
 		else
-			frag->texType = 2.0f;
+			frag->texType = (tex->flags & NVG_IMAGE_SDF) ? 3.0f : 2.0f;
 		#endif
 //		printf("frag->texType = %d\n", frag->texType);
 	} else {
@@ -971,14 +1018,31 @@ static int glnvg__convertPaint(GLNVGcontext* gl, GLNVGfragUniforms* frag, NVGpai
 
 static GLNVGfragUniforms* nvg__fragUniformPtr(GLNVGcontext* gl, int i);
 
+static int glnvg__sameUniforms(GLNVGcontext* gl, int offsetA, int offsetB, int n)
+{
+	int i;
+	if (offsetA == offsetB) return 1;
+	// Compare only the struct itself, uniform buffer alignment padding is never written.
+	for (i = 0; i < n; i++) {
+		if (memcmp(nvg__fragUniformPtr(gl, offsetA + i*gl->fragSize), nvg__fragUniformPtr(gl, offsetB + i*gl->fragSize), sizeof(GLNVGfragUniforms)) != 0)
+			return 0;
+	}
+	return 1;
+}
+
 static void glnvg__setUniforms(GLNVGcontext* gl, int uniformOffset, int image)
 {
+	// Skip the upload when the same values are already bound.
+	if (gl->boundUniformOffset == -1 || glnvg__sameUniforms(gl, gl->boundUniformOffset, uniformOffset, 1) == 0) {
 #if NANOVG_GL_USE_UNIFORMBUFFER
-	glBindBufferRange(GL_UNIFORM_BUFFER, GLNVG_FRAG_BINDING, gl->fragBuf, uniformOffset, sizeof(GLNVGfragUniforms));
+		glBindBufferRange(GL_UNIFORM_BUFFER, GLNVG_FRAG_BINDING, gl->fragBuf, uniformOffset, sizeof(GLNVGfragUniforms));
 #else
-	GLNVGfragUniforms* frag = nvg__fragUniformPtr(gl, uniformOffset);
-	glUniform4fv(gl->shader.loc[GLNVG_LOC_FRAG], NANOVG_GL_UNIFORMARRAY_SIZE, &(frag->uniformArray[0][0]));
+		GLNVGfragUniforms* frag = nvg__fragUniformPtr(gl, uniformOffset);
+		glUniform4fv(gl->shader.loc[GLNVG_LOC_FRAG], NANOVG_GL_UNIFORMARRAY_SIZE, &(frag->uniformArray[0][0]));
 #endif
+		gl->boundUniformOffset = uniformOffset;
+		gl->stats.uniformUploads++;
+	}
 
 	if (image != 0) {
 		GLNVGtexture* tex = glnvg__findTexture(gl, image);
@@ -997,10 +1061,70 @@ static void glnvg__renderViewport(void* uptr, float width, float height, float d
 	gl->view[1] = height;
 }
 
+static void glnvg__drawArrays(GLNVGcontext* gl, GLenum mode, GLint first, GLsizei count)
+{
+	glDrawArrays(mode, first, count);
+	gl->stats.drawCalls++;
+}
+
+static int glnvg__allocDraws(GLNVGcontext* gl, int n)
+{
+	if (n > gl->cdraws) {
+		GLint* firsts;
+		GLsizei* counts;
+		int cdraws = glnvg__maxi(n, 128) + gl->cdraws/2; // 1.5x Overallocate
+		firsts = (GLint*)realloc(gl->drawFirsts, sizeof(GLint) * cdraws);
+		if (firsts == NULL) return -1;
+		gl->drawFirsts = firsts;
+		counts = (GLsizei*)realloc(gl->drawCounts, sizeof(GLsizei) * cdraws);
+		if (counts == NULL) return -1;
+		gl->drawCounts = counts;
+		gl->cdraws = cdraws;
+	}
+	return 0;
+}
+
+// Draws the fill or stroke vertices of every path, with a single multi-draw when it is available.
+static void glnvg__drawPaths(GLNVGcontext* gl, GLenum mode, const GLNVGpath* paths, int npaths, int fill)
+{
+	int i, ndraws = 0;
+
+	if (glnvg__allocDraws(gl, npaths) == -1) {
+		for (i = 0; i < npaths; i++) {
+			if (fill)
+				glnvg__drawArrays(gl, mode, paths[i].fillOffset, paths[i].fillCount);
+			else
+				glnvg__drawArrays(gl, mode, paths[i].strokeOffset, paths[i].strokeCount);
+		}
+		return;
+	}
+
+	for (i = 0; i < npaths; i++) {
+		const int offset = fill ? paths[i].fillOffset : paths[i].strokeOffset;
+		const int count = fill ? paths[i].fillCount : paths[i].strokeCount;
+		if (count <= 0) continue;
+		gl->drawFirsts[ndraws] = offset;
+		gl->drawCounts[ndraws] = count;
+		ndraws++;
+	}
+
+#if defined NANOVG_GLES2 || defined NANOVG_GLES3
+	for (i = 0; i < ndraws; i++)
+		glnvg__drawArrays(gl, mode, gl->drawFirsts[i], gl->drawCounts[i]);
+#else
+	if (ndraws == 1) {
+		glnvg__drawArrays(gl, mode, gl->drawFirsts[0], gl->drawCounts[0]);
+	} else if (ndraws > 1) {
+		glMultiDrawArrays(mode, gl->drawFirsts, gl->drawCounts, ndraws);
+		gl->stats.drawCalls++;
+	}
+#endif
+}
+
 static void glnvg__fill(GLNVGcontext* gl, GLNVGcall* call)
 {
 	GLNVGpath* paths = &gl->paths[call->pathOffset];
-	int i, npaths = call->pathCount;
+	int npaths = call->pathCount;
 
 	// Draw shapes
 	glEnable(GL_STENCIL_TEST);
@@ -1015,8 +1139,7 @@ static void glnvg__fill(GLNVGcontext* gl, GLNVGcall* call)
 	glStencilOpSeparate(GL_FRONT, GL_KEEP, GL_KEEP, GL_INCR_WRAP);
 	glStencilOpSeparate(GL_BACK, GL_KEEP, GL_KEEP, GL_DECR_WRAP);
 	glDisable(GL_CULL_FACE);
-	for (i = 0; i < npaths; i++)
-		glDrawArrays(GL_TRIANGLE_FAN, paths[i].fillOffset, paths[i].fillCount);
+	glnvg__drawPaths(gl, GL_TRIANGLE_FAN, paths, npaths, 1);
 	glEnable(GL_CULL_FACE);
 
 	// Draw anti-aliased pixels
@@ -1029,14 +1152,13 @@ static void glnvg__fill(GLNVGcontext* gl, GLNVGcall* call)
 		glnvg__stencilFunc(gl, GL_EQUAL, 0x00, 0xff);
 		glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
 		// Draw fringes
-		for (i = 0; i < npaths; i++)
-			glDrawArrays(GL_TRIANGLE_STRIP, paths[i].strokeOffset, paths[i].strokeCount);
+		glnvg__drawPaths(gl, GL_TRIANGLE_STRIP, paths, npaths, 0);
 	}
 
 	// Draw fill
 	glnvg__stencilFunc(gl, GL_NOTEQUAL, 0x0, 0xff);
 	glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
-	glDrawArrays(GL_TRIANGLE_STRIP, call->triangleOffset, call->triangleCount);
+	glnvg__drawArrays(gl, GL_TRIANGLE_STRIP, call->triangleOffset, call->triangleCount);
 
 	glDisable(GL_STENCIL_TEST);
 }
@@ -1044,24 +1166,21 @@ static void glnvg__fill(GLNVGcontext* gl, GLNVGcall* call)
 static void glnvg__convexFill(GLNVGcontext* gl, GLNVGcall* call)
 {
 	GLNVGpath* paths = &gl->paths[call->pathOffset];
-	int i, npaths = call->pathCount;
+	int npaths = call->pathCount;
 
 	glnvg__setUniforms(gl, call->uniformOffset, call->image);
 	glnvg__checkError(gl, "convex fill");
 
-	for (i = 0; i < npaths; i++) {
-		glDrawArrays(GL_TRIANGLE_FAN, paths[i].fillOffset, paths[i].fillCount);
-		// Draw fringes
-		if (paths[i].strokeCount > 0) {
-			glDrawArrays(GL_TRIANGLE_STRIP, paths[i].strokeOffset, paths[i].strokeCount);
-		}
-	}
+	// Every path shares one paint, so drawing all fills before all fringes blends the same as interleaving them.
+	glnvg__drawPaths(gl, GL_TRIANGLE_FAN, paths, npaths, 1);
+	// Draw fringes
+	glnvg__drawPaths(gl, GL_TRIANGLE_STRIP, paths, npaths, 0);
 }
 
 static void glnvg__stroke(GLNVGcontext* gl, GLNVGcall* call)
 {
 	GLNVGpath* paths = &gl->paths[call->pathOffset];
-	int npaths = call->pathCount, i;
+	int npaths = call->pathCount;
 
 	if (gl->flags & NVG_STENCIL_STROKES) {
 
@@ -1073,23 +1192,20 @@ static void glnvg__stroke(GLNVGcontext* gl, GLNVGcall* call)
 		glStencilOp(GL_KEEP, GL_KEEP, GL_INCR);
 		glnvg__setUniforms(gl, call->uniformOffset + gl->fragSize, call->image);
 		glnvg__checkError(gl, "stroke fill 0");
-		for (i = 0; i < npaths; i++)
-			glDrawArrays(GL_TRIANGLE_STRIP, paths[i].strokeOffset, paths[i].strokeCount);
+		glnvg__drawPaths(gl, GL_TRIANGLE_STRIP, paths, npaths, 0);
 
 		// Draw anti-aliased pixels.
 		glnvg__setUniforms(gl, call->uniformOffset, call->image);
 		glnvg__stencilFunc(gl, GL_EQUAL, 0x00, 0xff);
 		glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
-		for (i = 0; i < npaths; i++)
-			glDrawArrays(GL_TRIANGLE_STRIP, paths[i].strokeOffset, paths[i].strokeCount);
+		glnvg__drawPaths(gl, GL_TRIANGLE_STRIP, paths, npaths, 0);
 
 		// Clear stencil buffer.
 		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
 		glnvg__stencilFunc(gl, GL_ALWAYS, 0x0, 0xff);
 		glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
 		glnvg__checkError(gl, "stroke fill 1");
-		for (i = 0; i < npaths; i++)
-			glDrawArrays(GL_TRIANGLE_STRIP, paths[i].strokeOffset, paths[i].strokeCount);
+		glnvg__drawPaths(gl, GL_TRIANGLE_STRIP, paths, npaths, 0);
 		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
 		glDisable(GL_STENCIL_TEST);
@@ -1100,8 +1216,7 @@ static void glnvg__stroke(GLNVGcontext* gl, GLNVGcall* call)
 		glnvg__setUniforms(gl, call->uniformOffset, call->image);
 		glnvg__checkError(gl, "stroke fill");
 		// Draw Strokes
-		for (i = 0; i < npaths; i++)
-			glDrawArrays(GL_TRIANGLE_STRIP, paths[i].strokeOffset, paths[i].strokeCount);
+		glnvg__drawPaths(gl, GL_TRIANGLE_STRIP, paths, npaths, 0);
 	}
 }
 
@@ -1110,7 +1225,7 @@ static void glnvg__triangles(GLNVGcontext* gl, GLNVGcall* call)
 	glnvg__setUniforms(gl, call->uniformOffset, call->image);
 	glnvg__checkError(gl, "triangles fill");
 
-	glDrawArrays(GL_TRIANGLES, call->triangleOffset, call->triangleCount);
+	glnvg__drawArrays(gl, GL_TRIANGLES, call->triangleOffset, call->triangleCount);
 }
 
 static void glnvg__renderCancel(void* uptr) {
@@ -1165,6 +1280,63 @@ static GLNVGblend glnvg__blendCompositeOperation(NVGcompositeOperationState op)
 	return blend;
 }
 
+static int glnvg__isOpaquePaint(GLNVGcontext* gl, GLNVGcall* call)
+{
+	GLNVGfragUniforms* frag = nvg__fragUniformPtr(gl, call->uniformOffset);
+	return call->image == 0 && frag->innerCol.a >= 1.0f && frag->outerCol.a >= 1.0f;
+}
+
+static int glnvg__canMergeCalls(GLNVGcontext* gl, GLNVGcall* prev, GLNVGcall* call)
+{
+	int nuniforms = 1;
+
+	if (prev->type != call->type || prev->image != call->image)
+		return 0;
+	if (memcmp(&prev->blendFunc, &call->blendFunc, sizeof(GLNVGblend)) != 0)
+		return 0;
+
+	if (call->type == GLNVG_CONVEXFILL) {
+		if (call->pathOffset != prev->pathOffset + prev->pathCount)
+			return 0;
+	} else if (call->type == GLNVG_STROKE) {
+		if (call->pathOffset != prev->pathOffset + prev->pathCount)
+			return 0;
+		if (gl->flags & NVG_STENCIL_STROKES) {
+			// Stencil strokes draw overlaps once, which only looks the same as separate calls when nothing shows through.
+			if (glnvg__isOpaquePaint(gl, prev) == 0)
+				return 0;
+			nuniforms = 2;
+		}
+	} else if (call->type == GLNVG_TRIANGLES) {
+		if (call->triangleOffset != prev->triangleOffset + prev->triangleCount)
+			return 0;
+	} else {
+		// Concave fills each need their own stencil pass and cover quad.
+		return 0;
+	}
+
+	return glnvg__sameUniforms(gl, prev->uniformOffset, call->uniformOffset, nuniforms);
+}
+
+// Merges runs of consecutive calls that share type, paint, texture and blend state so they are drawn together.
+static void glnvg__mergeCalls(GLNVGcontext* gl)
+{
+	int i, ncalls = 0;
+	for (i = 0; i < gl->ncalls; i++) {
+		GLNVGcall* call = &gl->calls[i];
+		if (ncalls > 0 && glnvg__canMergeCalls(gl, &gl->calls[ncalls-1], call)) {
+			GLNVGcall* prev = &gl->calls[ncalls-1];
+			prev->pathCount += call->pathCount;
+			prev->triangleCount += call->triangleCount;
+			continue;
+		}
+		if (ncalls != i)
+			gl->calls[ncalls] = *call;
+		ncalls++;
+	}
+	gl->ncalls = ncalls;
+}
+
 static void glnvg__renderFlush(void* uptr)
 {
 	GLNVGcontext* gl = (GLNVGcontext*)uptr;
@@ -1172,6 +1344,10 @@ static void glnvg__renderFlush(void* uptr)
 
 	if (gl->ncalls > 0) {
 
+		gl->stats.calls += gl->ncalls;
+		glnvg__mergeCalls(gl);
+		gl->stats.batches += gl->ncalls;
+
 		// Setup require GL state.
 		glUseProgram(gl->shader.prog);
 
@@ -1198,6 +1374,7 @@ static void glnvg__renderFlush(void* uptr)
 		gl->blendFunc.dstRGB = GL_INVALID_ENUM;
 		gl->blendFunc.dstAlpha = GL_INVALID_ENUM;
 		#endif
+		gl->boundUniformOffset = -1;
 
 #if NANOVG_GL_USE_UNIFORMBUFFER
 		// Upload ubo for frag shaders
@@ -1544,6 +1721,8 @@ static void glnvg__renderDelete(void* uptr)
 	free(gl->verts);
 	free(gl->uniforms);
 	free(gl->calls);
+	free(gl->drawFirsts);
+	free(gl->drawCounts);
 
 	free(gl);
 }
@@ -1580,6 +1759,7 @@ NVGcontext* nvgCreateGLES3(int flags)
 	params.renderDelete = glnvg__renderDelete;
 	params.userPtr = gl;
 	params.edgeAntiAlias = flags & NVG_ANTIALIAS ? 1 : 0;
+	params.sdfText = flags & NVG_SDF_TEXT ? 1 : 0;
 
 	gl->flags = flags;
 
@@ -1646,4 +1826,32 @@ GLuint nvglImageHandleGLES3(NVGcontext* ctx, int image)
 	return tex->tex;
 }
 
+#if defined NANOVG_GL2
+void nvglGetStatsGL2(NVGcontext* ctx, NVGglStats* stats)
+#elif defined NANOVG_GL3
+void nvglGetStatsGL3(NVGcontext* ctx, NVGglStats* stats)
+#elif defined NANOVG_GLES2
+void nvglGetStatsGLES2(NVGcontext* ctx, NVGglStats* stats)
+#elif defined NANOVG_GLES3
+void nvglGetStatsGLES3(NVGcontext* ctx, NVGglStats* stats)
+#endif
+{
+	GLNVGcontext* gl = (GLNVGcontext*)nvgInternalParams(ctx)->userPtr;
+	*stats = gl->stats;
+}
+
+#if defined NANOVG_GL2
+void nvglResetStatsGL2(NVGcontext* ctx)
+#elif defined NANOVG_GL3
+void nvglResetStatsGL3(NVGcontext* ctx)
+#elif defined NANOVG_GLES2
+void nvglResetStatsGLES2(NVGcontext* ctx)
+#elif defined NANOVG_GLES3
+void nvglResetStatsGLES3(NVGcontext* ctx)
+#endif
+{
+	GLNVGcontext* gl = (GLNVGcontext*)nvgInternalParams(ctx)->userPtr;
+	memset(&gl->stats, 0, sizeof(gl->stats));
+}
+
 #endif /* NANOVG_GL_IMPLEMENTATION */
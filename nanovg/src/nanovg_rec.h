@@ -0,0 +1,359 @@
+//
+// Copyright (c) 2009-2013 Mikko Mononen memon@inside.org
+//
+// This software is provided 'as-is', without any express or implied
+// warranty.  In no event will the authors be held liable for any damages
+// arising from the use of this software.
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+#ifndef NANOVG_REC_H
+#define NANOVG_REC_H
+
+// Recording back-end, nothing is drawn.
+// Every fill, stroke and triangle (text) call is appended to an in-memory command log along with the
+// number of vertices nanovg tessellated for it. This allows drawing code to be run and measured
+// without a GPU or an OpenGL context.
+//
+// Define NANOVG_REC_IMPLEMENTATION in exactly one source file before including this header.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Create flags
+
+enum NVGrecCreateFlags {
+	// Same meaning as NVG_ANTIALIAS for the GL back-ends, changes the number of vertices generated.
+	NVG_REC_ANTIALIAS	= 1<<0,
+	// Same meaning as NVG_SDF_TEXT for the GL back-ends, changes the glyphs added to the font atlas.
+	NVG_REC_SDF_TEXT	= 1<<1,
+};
+
+enum NVGrecCommandType {
+	NVG_REC_FILL		= 1,
+	NVG_REC_STROKE		= 2,
+	// Triangles are only submitted by nanovg for text, each one of these is a text run.
+	NVG_REC_TRIANGLES	= 3,
+};
+
+struct NVGrecCommand {
+	int type;
+	int image;
+	int npaths;
+	// Fill and fringe vertices for fills, stroke vertices for strokes, triangle vertices for text.
+	int nverts;
+};
+typedef struct NVGrecCommand NVGrecCommand;
+
+// Totals for all commands currently in the log.
+struct NVGrecStats {
+	int fills;
+	int strokes;
+	int triangles;
+	int paths;
+	int verts;
+	// Number of times nvgEndFrame() was called since the log was last cleared.
+	int frames;
+	// Number of texture uploads, including glyphs added to the font atlas.
+	int textureUpdates;
+};
+typedef struct NVGrecStats NVGrecStats;
+
+NVGcontext* nvgCreateRec(int flags);
+void nvgDeleteRec(NVGcontext* ctx);
+
+// Returns the command log, valid until the next drawing call or nvgRecClear().
+const NVGrecCommand* nvgRecCommands(NVGcontext* ctx, int* ncommands);
+void nvgRecGetStats(NVGcontext* ctx, NVGrecStats* stats);
+// Empties the command log and resets all stats.
+void nvgRecClear(NVGcontext* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NANOVG_REC_H */
+
+#ifdef NANOVG_REC_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <string.h>
+#include "nanovg.h"
+
+struct RECtexture {
+	int id;
+	int type;
+	int width, height;
+	int flags;
+};
+typedef struct RECtexture RECtexture;
+
+struct RECcontext {
+	RECtexture* textures;
+	int ntextures;
+	int ctextures;
+	int textureId;
+
+	NVGrecCommand* commands;
+	int ncommands;
+	int ccommands;
+	// Commands after this index belong to the frame in progress and are dropped by nvgCancelFrame().
+	int frameBegin;
+
+	int frames;
+	int textureUpdates;
+};
+typedef struct RECcontext RECcontext;
+
+static RECtexture* recnvg__findTexture(RECcontext* rec, int id)
+{
+	int i;
+	for (i = 0; i < rec->ntextures; i++)
+		if (rec->textures[i].id == id)
+			return &rec->textures[i];
+	return NULL;
+}
+
+static NVGrecCommand* recnvg__allocCommand(RECcontext* rec)
+{
+	if (rec->ncommands+1 > rec->ccommands) {
+		NVGrecCommand* commands;
+		int ccommands = rec->ccommands == 0 ? 256 : rec->ccommands * 2;
+		commands = (NVGrecCommand*)realloc(rec->commands, sizeof(NVGrecCommand) * ccommands);
+		if (commands == NULL) return NULL;
+		rec->commands = commands;
+		rec->ccommands = ccommands;
+	}
+	memset(&rec->commands[rec->ncommands], 0, sizeof(NVGrecCommand));
+	return &rec->commands[rec->ncommands++];
+}
+
+static int recnvg__renderCreate(void* uptr)
+{
+	NVG_NOTUSED(uptr);
+	return 1;
+}
+
+static int recnvg__renderCreateTexture(void* uptr, int type, int w, int h, int imageFlags, const unsigned char* data)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	RECtexture* tex;
+	NVG_NOTUSED(data);
+
+	if (rec->ntextures+1 > rec->ctextures) {
+		RECtexture* textures;
+		int ctextures = rec->ctextures == 0 ? 4 : rec->ctextures * 2;
+		textures = (RECtexture*)realloc(rec->textures, sizeof(RECtexture) * ctextures);
+		if (textures == NULL) return 0;
+		rec->textures = textures;
+		rec->ctextures = ctextures;
+	}
+	tex = &rec->textures[rec->ntextures++];
+	tex->id = ++rec->textureId;
+	tex->type = type;
+	tex->width = w;
+	tex->height = h;
+	tex->flags = imageFlags;
+	return tex->id;
+}
+
+static int recnvg__renderDeleteTexture(void* uptr, int image)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	RECtexture* tex = recnvg__findTexture(rec, image);
+	if (tex == NULL) return 0;
+	*tex = rec->textures[--rec->ntextures];
+	return 1;
+}
+
+static int recnvg__renderUpdateTexture(void* uptr, int image, int x, int y, int w, int h, const unsigned char* data)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	NVG_NOTUSED(x);
+	NVG_NOTUSED(y);
+	NVG_NOTUSED(w);
+	NVG_NOTUSED(h);
+	NVG_NOTUSED(data);
+	if (recnvg__findTexture(rec, image) == NULL) return 0;
+	rec->textureUpdates++;
+	return 1;
+}
+
+static int recnvg__renderGetTextureSize(void* uptr, int image, int* w, int* h)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	RECtexture* tex = recnvg__findTexture(rec, image);
+	if (tex == NULL) return 0;
+	*w = tex->width;
+	*h = tex->height;
+	return 1;
+}
+
+static void recnvg__renderViewport(void* uptr, float width, float height, float devicePixelRatio)
+{
+	NVG_NOTUSED(uptr);
+	NVG_NOTUSED(width);
+	NVG_NOTUSED(height);
+	NVG_NOTUSED(devicePixelRatio);
+}
+
+static void recnvg__renderCancel(void* uptr)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	rec->ncommands = rec->frameBegin;
+}
+
+static void recnvg__renderFlush(void* uptr)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	rec->frameBegin = rec->ncommands;
+	rec->frames++;
+}
+
+static void recnvg__renderFill(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, float fringe,
+							   const float* bounds, const NVGpath* paths, int npaths)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	NVGrecCommand* cmd = recnvg__allocCommand(rec);
+	int i;
+	NVG_NOTUSED(compositeOperation);
+	NVG_NOTUSED(scissor);
+	NVG_NOTUSED(fringe);
+	NVG_NOTUSED(bounds);
+	if (cmd == NULL) return;
+
+	cmd->type = NVG_REC_FILL;
+	cmd->image = paint->image;
+	cmd->npaths = npaths;
+	for (i = 0; i < npaths; i++)
+		cmd->nverts += paths[i].nfill + paths[i].nstroke;
+}
+
+static void recnvg__renderStroke(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, float fringe,
+								 float strokeWidth, const NVGpath* paths, int npaths)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	NVGrecCommand* cmd = recnvg__allocCommand(rec);
+	int i;
+	NVG_NOTUSED(compositeOperation);
+	NVG_NOTUSED(scissor);
+	NVG_NOTUSED(fringe);
+	NVG_NOTUSED(strokeWidth);
+	if (cmd == NULL) return;
+
+	cmd->type = NVG_REC_STROKE;
+	cmd->image = paint->image;
+	cmd->npaths = npaths;
+	for (i = 0; i < npaths; i++)
+		cmd->nverts += paths[i].nstroke;
+}
+
+static void recnvg__renderTriangles(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor,
+									const NVGvertex* verts, int nverts)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	NVGrecCommand* cmd = recnvg__allocCommand(rec);
+	NVG_NOTUSED(compositeOperation);
+	NVG_NOTUSED(scissor);
+	NVG_NOTUSED(verts);
+	if (cmd == NULL) return;
+
+	cmd->type = NVG_REC_TRIANGLES;
+	cmd->image = paint->image;
+	cmd->npaths = 0;
+	cmd->nverts = nverts;
+}
+
+static void recnvg__renderDelete(void* uptr)
+{
+	RECcontext* rec = (RECcontext*)uptr;
+	if (rec == NULL) return;
+	free(rec->textures);
+	free(rec->commands);
+	free(rec);
+}
+
+NVGcontext* nvgCreateRec(int flags)
+{
+	NVGparams params;
+	NVGcontext* ctx = NULL;
+	RECcontext* rec = (RECcontext*)malloc(sizeof(RECcontext));
+	if (rec == NULL) goto error;
+	memset(rec, 0, sizeof(RECcontext));
+
+	memset(&params, 0, sizeof(params));
+	params.renderCreate = recnvg__renderCreate;
+	params.renderCreateTexture = recnvg__renderCreateTexture;
+	params.renderDeleteTexture = recnvg__renderDeleteTexture;
+	params.renderUpdateTexture = recnvg__renderUpdateTexture;
+	params.renderGetTextureSize = recnvg__renderGetTextureSize;
+	params.renderViewport = recnvg__renderViewport;
+	params.renderCancel = recnvg__renderCancel;
+	params.renderFlush = recnvg__renderFlush;
+	params.renderFill = recnvg__renderFill;
+	params.renderStroke = recnvg__renderStroke;
+	params.renderTriangles = recnvg__renderTriangles;
+	params.renderDelete = recnvg__renderDelete;
+	params.userPtr = rec;
+	params.edgeAntiAlias = flags & NVG_REC_ANTIALIAS ? 1 : 0;
+	params.sdfText = flags & NVG_REC_SDF_TEXT ? 1 : 0;
+
+	ctx = nvgCreateInternal(&params);
+	if (ctx == NULL) goto error;
+
+	return ctx;
+
+error:
+	// 'rec' is freed by nvgDeleteInternal.
+	if (ctx != NULL) nvgDeleteInternal(ctx);
+	return NULL;
+}
+
+void nvgDeleteRec(NVGcontext* ctx)
+{
+	nvgDeleteInternal(ctx);
+}
+
+const NVGrecCommand* nvgRecCommands(NVGcontext* ctx, int* ncommands)
+{
+	RECcontext* rec = (RECcontext*)nvgInternalParams(ctx)->userPtr;
+	*ncommands = rec->ncommands;
+	return rec->commands;
+}
+
+void nvgRecGetStats(NVGcontext* ctx, NVGrecStats* stats)
+{
+	RECcontext* rec = (RECcontext*)nvgInternalParams(ctx)->userPtr;
+	int i;
+	memset(stats, 0, sizeof(NVGrecStats));
+	for (i = 0; i < rec->ncommands; i++) {
+		const NVGrecCommand* cmd = &rec->commands[i];
+		if (cmd->type == NVG_REC_FILL) stats->fills++;
+		else if (cmd->type == NVG_REC_STROKE) stats->strokes++;
+		else if (cmd->type == NVG_REC_TRIANGLES) stats->triangles++;
+		stats->paths += cmd->npaths;
+		stats->verts += cmd->nverts;
+	}
+	stats->frames = rec->frames;
+	stats->textureUpdates = rec->textureUpdates;
+}
+
+void nvgRecClear(NVGcontext* ctx)
+{
+	RECcontext* rec = (RECcontext*)nvgInternalParams(ctx)->userPtr;
+	rec->ncommands = 0;
+	rec->frameBegin = 0;
+	rec->frames = 0;
+	rec->textureUpdates = 0;
+}
+
+#endif /* NANOVG_REC_IMPLEMENTATION */
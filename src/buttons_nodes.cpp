@@ -2,6 +2,7 @@
 
 #include "drawing.h"
 #include "gui_sizes.h"
+#include "node_registry.h"
 
 float cse::NodeCreationButton::draw(NVGcontext* const draw_context, const Float2 draw_origin, const Float2 parent_local_mouse_pos, const float parent_width)
 {
@@ -33,3 +34,15 @@ bool cse::NodeCreationButton::is_mouse_over_button()
 
 	return false;
 }
+
+cse::NodeTypeButton::NodeTypeButton(const NodeTypeInfo& type_info) :
+	type_info(type_info)
+{
+	label = type_info.title;
+}
+
+std::shared_ptr<cse::EditableNode> cse::NodeTypeButton::create_node()
+{
+	const Float2 irrelevant_position(0.0f, 0.0f);
+	return type_info.create(irrelevant_position);
+}
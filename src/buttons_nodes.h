@@ -10,6 +10,7 @@ struct NVGcontext;
 namespace cse {
 
 	class EditableNode;
+	class NodeTypeInfo;
 
 	class NodeCreationButton {
 	public:
@@ -31,20 +32,15 @@ namespace cse {
 		float button_width;
 	};
 
-	// Generic
-	template<typename T>
-	class GenericNodeButton : public NodeCreationButton {
+	// Creates nodes of any type described by the node type registry
+	class NodeTypeButton : public NodeCreationButton {
 	public:
-		GenericNodeButton() {
-			const Float2 irrelevant_position(0.0f, 0.0f);
-			const T tmp_node(irrelevant_position);
-			this->label = tmp_node.get_title();
-		}
-
-		virtual std::shared_ptr<EditableNode> create_node() override {
-			const Float2 irrelevant_position(0.0f, 0.0f);
-			return std::make_shared<T>(irrelevant_position);
-		}
+		NodeTypeButton(const NodeTypeInfo& type_info);
+
+		virtual std::shared_ptr<EditableNode> create_node() override;
+
+	private:
+		const NodeTypeInfo& type_info;
 	};
 
 }
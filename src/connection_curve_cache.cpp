@@ -0,0 +1,36 @@
+#include "connection_curve_cache.h"
+
+#include "drawing.h"
+
+const std::vector<cse::Float2>& cse::ConnectionCurveCache::get_curve(
+	const NodeSocket* const begin_socket,
+	const NodeSocket* const end_socket,
+	const Float2 begin_pos,
+	const Float2 end_pos,
+	const float zoom_scale
+	)
+{
+	CachedCurve& curve = curves[std::make_pair(begin_socket, end_socket)];
+	curve.used = true;
+	// The curve's shape depends only on its end points, so it does not matter if the sockets have been replaced
+	if (curve.points.empty() || curve.begin_pos != begin_pos || curve.end_pos != end_pos || curve.zoom_scale != zoom_scale) {
+		curve.begin_pos = begin_pos;
+		curve.end_pos = end_pos;
+		curve.zoom_scale = zoom_scale;
+		Drawing::flatten_node_connection_curve(begin_pos, end_pos, zoom_scale, curve.points);
+	}
+	return curve.points;
+}
+
+void cse::ConnectionCurveCache::remove_unused()
+{
+	for (auto iter = curves.begin(); iter != curves.end(); ) {
+		if (iter->second.used) {
+			iter->second.used = false;
+			++iter;
+		}
+		else {
+			iter = curves.erase(iter);
+		}
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "util_vector.h"
+
+namespace cse {
+
+	class NodeSocket;
+
+	// Holds the flattened curve of each connection so curves are only evaluated again when a connected node moves or the zoom changes
+	class ConnectionCurveCache {
+	public:
+		// Returns the points of the curve between the two sockets, reusing the previous result if nothing has changed
+		const std::vector<Float2>& get_curve(const NodeSocket* begin_socket, const NodeSocket* end_socket, Float2 begin_pos, Float2 end_pos, float zoom_scale);
+
+		// Removes every curve that was not requested since the last call, so deleted and offscreen connections do not build up
+		void remove_unused();
+
+	private:
+		class CachedCurve {
+		public:
+			Float2 begin_pos;
+			Float2 end_pos;
+			float zoom_scale = 0.0f;
+			bool used = false;
+			std::vector<Float2> points;
+		};
+
+		std::map<std::pair<const NodeSocket*, const NodeSocket*>, CachedCurve> curves;
+	};
+
+}
@@ -1,171 +1,215 @@
 #include "curve.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <vector>
 
 #include "sockets.h"
 #include "util_enum.h"
 #include "util_hermite_spline.h"
 
-cse::CurveEvaluator::CurveEvaluator(CurveSocketValue* const curve_socket_val, const int segments)
+// Number of steps used to find t for a given x on a hermite segment
+// Each step is a newton step, or a bisection step if newton would leave the known bounds
+static constexpr int HERMITE_SOLVE_STEPS = 12;
+static constexpr float MIN_NEWTON_SLOPE = 1.0e-6f;
+
+// Samples of a hermite segment are solved in blocks of this size
+// Each step of the solve runs over the whole block, which gives the compiler a simple loop it can evaluate with SIMD instructions
+static constexpr int HERMITE_SOLVE_BLOCK_SIZE = 64;
+
+// Fill out[first_index] to out[end_index - 1] with samples of the hermite segment from b to c
+static void sample_hermite_segment(
+	const cse::Float2 a,
+	const cse::Float2 b,
+	const cse::Float2 c,
+	const cse::Float2 d,
+	const float x_increment,
+	const int first_index,
+	const int end_index,
+	float* const out)
 {
-	const std::vector<Float2>& curve_control_points = curve_socket_val->curve_points;
-
-	// No points, in this case treat as output = input
-	if (curve_control_points.size() == 0) {
-		const Float2 point_0(0.0f, 0.0f);
-		const Float2 point_1(1.0f, 1.0f);
-		sampled_points.push_back(point_0);
-		sampled_points.push_back(point_1);
-		return;
-	}
-	// One point, this represents constant output
-	else if (curve_control_points.size() == 1) {
-		const float const_output = curve_control_points[0].y;
-		const Float2 point_0(0.0f, const_output);
-		const Float2 point_1(1.0f, const_output);
-		sampled_points.push_back(point_0);
-		sampled_points.push_back(point_1);
-		return;
-	}
-
-	if (curve_socket_val->curve_interp == CurveInterpolation::CUBIC_HERMITE) {
-		// Sample as a series of cubic hermite splines
-		constexpr float FIRST_SAMPLE_X = 0.0f;
-		constexpr float LAST_SAMPLE_X = 1.0f;
-	
-		typedef std::vector<Float2>::size_type vec_fp_size_t;
-
-		const float x_increment = (LAST_SAMPLE_X - FIRST_SAMPLE_X) / segments;
-		float next_sample_x = FIRST_SAMPLE_X;
-		const vec_fp_size_t final_segment_begin_index = curve_control_points.size() - 2;
-		for (vec_fp_size_t segment_begin_index = 0; segment_begin_index <= final_segment_begin_index; segment_begin_index++) {
-			const Float2 point_b = curve_control_points[segment_begin_index];
-			const Float2 point_c = curve_control_points[segment_begin_index + 1];
-			Float2 point_a, point_d;
-			if (segment_begin_index == 0) {
-				point_a = point_b + point_b - point_c;
-			}
-			else {
-				point_a = curve_control_points[segment_begin_index - 1];
-			}
-			if (segment_begin_index == final_segment_begin_index) {
-				point_d = point_c + point_c - point_b;
-			}
-			else {
-				point_d = curve_control_points[segment_begin_index + 2];
-			}
-			CurveEvaluator hermite_spline(point_a, point_b, point_c, point_d);
-
-			// If the sample is before the first control point(b), use the value of the first control point
-			while (next_sample_x <= LAST_SAMPLE_X && hermite_spline.compare_to_range(next_sample_x) == -1) {
-				const Float2 new_point(next_sample_x, point_b.y);
-				sampled_points.push_back(new_point);
-				next_sample_x += x_increment;
-			}
+	const cse::CubicHermiteSplineInterpolator x_solver(a.x, b.x, c.x, d.x);
+	const cse::CubicHermiteSplineInterpolator y_solver(a.y, b.y, c.y, d.y);
+	const float inv_x_delta = 1.0f / (c.x - b.x);
+
+	float target_x[HERMITE_SOLVE_BLOCK_SIZE];
+	float t[HERMITE_SOLVE_BLOCK_SIZE];
+	float t_min[HERMITE_SOLVE_BLOCK_SIZE];
+	float t_max[HERMITE_SOLVE_BLOCK_SIZE];
+
+	for (int block_begin = first_index; block_begin < end_index; block_begin += HERMITE_SOLVE_BLOCK_SIZE) {
+		const int block_size = std::min(HERMITE_SOLVE_BLOCK_SIZE, end_index - block_begin);
+
+		// x(0) = b.x and x(1) = c.x, so each solution is bounded by t = 0 and t = 1
+		// Evenly spaced points give a linear x(t), in which case this first guess is already correct
+		// The whole block is always solved even if it is not full, fixed length loops are easier for the compiler to vectorize
+		for (int i = 0; i < HERMITE_SOLVE_BLOCK_SIZE; i++) {
+			target_x[i] = (block_begin + i) * x_increment;
+			t[i] = std::min(std::max((target_x[i] - b.x) * inv_x_delta, 0.0f), 1.0f);
+			t_min[i] = 0.0f;
+			t_max[i] = 1.0f;
+		}
 
-			// If the sample is in this range, evaluate normally
-			while (next_sample_x <= LAST_SAMPLE_X && hermite_spline.compare_to_range(next_sample_x) == 0) {
-				const float sampled_y = hermite_spline.eval(next_sample_x);
-				const Float2 new_point(next_sample_x, sampled_y);
-				sampled_points.push_back(new_point);
-				next_sample_x += x_increment;
+		for (int step = 0; step < HERMITE_SOLVE_STEPS; step++) {
+			for (int i = 0; i < HERMITE_SOLVE_BLOCK_SIZE; i++) {
+				const float this_t = t[i];
+				const float error = x_solver.eval(this_t) - target_x[i];
+				const bool below_target = error < 0.0f;
+				const float this_t_min = below_target ? this_t : t_min[i];
+				const float this_t_max = below_target ? t_max[i] : this_t;
+				// x(t) is increasing wherever newton is useful, a flat or negative slope gets a huge step that fails the bounds check below
+				const float slope = std::max(x_solver.eval_derivative(this_t), MIN_NEWTON_SLOPE);
+				const float newton_t = this_t - error / slope;
+				const float bisect_t = 0.5f * (this_t_min + this_t_max);
+				const float low_checked_t = newton_t < this_t_min ? bisect_t : newton_t;
+				t[i] = low_checked_t > this_t_max ? bisect_t : low_checked_t;
+				t_min[i] = this_t_min;
+				t_max[i] = this_t_max;
 			}
+		}
 
-			// If the sample is past this range and we are in the last segment, use the value of the last control point
-			while (next_sample_x <= LAST_SAMPLE_X && hermite_spline.compare_to_range(next_sample_x) == 1 && segment_begin_index == final_segment_begin_index) {
-				const Float2 new_point(next_sample_x, point_c.y);
-				sampled_points.push_back(new_point);
-				next_sample_x += x_increment;
-			}
+		for (int i = 0; i < block_size; i++) {
+			out[block_begin + i] = y_solver.eval(t[i]);
 		}
 	}
-	else {
-		// Default is linear
-		// In this case, copy points directly rather than sampling
-		for (const Float2 this_point : curve_control_points) {
-			sampled_points.push_back(this_point);
-		}
+}
+
+// Fill out[first_index] to out[end_index - 1] with samples of the straight line from b to c
+static void sample_linear_segment(const cse::Float2 b, const cse::Float2 c, const float x_increment, const int first_index, const int end_index, float* const out)
+{
+	const float slope = (c.y - b.y) / (c.x - b.x);
+	for (int i = first_index; i < end_index; i++) {
+		const float target_x = i * x_increment;
+		out[i] = b.y + (target_x - b.x) * slope;
 	}
 }
 
-cse::CurveEvaluator::CurveEvaluator(const std::shared_ptr<CurveSocketValue> curve_socket_val, const int segments) : CurveEvaluator(curve_socket_val.get(), segments)
+cse::CurveEvaluator::CurveEvaluator(const CurveSocketValue* const curve_socket_val, const int segments) :
+	samples(segments + 1)
 {
+	sample_curve(curve_socket_val, 0, segments);
+}
 
+cse::CurveEvaluator::CurveEvaluator(const CurveSocketValue* const curve_socket_val, const float begin_x, const float end_x, const int segments) :
+	samples(segments + 1)
+{
+	const int first_index = std::max(0, static_cast<int>(std::floor(begin_x * segments)));
+	const int last_index = std::min(segments, static_cast<int>(std::ceil(end_x * segments)));
+	sample_curve(curve_socket_val, first_index, last_index);
 }
 
-cse::CurveEvaluator::CurveEvaluator(const Float2 a, const Float2 b, const Float2 c, const Float2 d, const int segments)
+cse::CurveEvaluator::CurveEvaluator(const std::shared_ptr<CurveSocketValue> curve_socket_val, const int segments) : CurveEvaluator(curve_socket_val.get(), segments)
 {
-	const CubicHermiteSplineInterpolator x_solver(a.x, b.x, c.x, d.x);
-	const CubicHermiteSplineInterpolator y_solver(a.y, b.y, c.y, d.y);
-
-	const float segment_size = 1.0f / segments;
-	for (int i = 0; i <= segments; i++) {
-		const float this_t = segment_size * i;
-		const float this_x = x_solver.eval(this_t);
-		const float this_y = y_solver.eval(this_t);
-		const Float2 this_point(this_x, this_y);
-		sampled_points.push_back(this_point);
-	}
+
 }
 
-int cse::CurveEvaluator::compare_to_range(const float in_value) const
+float cse::CurveEvaluator::eval(const float in_value) const
 {
-	if (sampled_points.size() < 1) {
-		return 0;
+	if (samples.size() < 2) {
+		return in_value;
 	}
 
-	const float first = sampled_points[0].x;
-	if (in_value < first) {
-		return -1;
-	}
+	// Samples are evenly spaced, so the two surrounding samples can be found directly
+	const int segments = static_cast<int>(samples.size()) - 1;
+	const float scaled_value = std::min(std::max(in_value * segments, 0.0f), static_cast<float>(segments));
+	const int min_index = std::min(static_cast<int>(scaled_value), segments - 1);
 
-	const float last = sampled_points[sampled_points.size() - 1].x;
-	if (in_value > last) {
-		return 1;
-	}
+	const float weight_factor = scaled_value - min_index;
+	const float result = (1.0f - weight_factor) * samples[min_index] + weight_factor * samples[min_index + 1];
 
-	return 0;
+	return result;
 }
 
-float cse::CurveEvaluator::eval(const float in_value) const
+const std::vector<float>& cse::CurveEvaluator::get_samples() const
 {
-	if (sampled_points.size() < 2) {
-		return in_value;
-	}
+	return samples;
+}
 
-	typedef std::vector<Float2>::size_type vec_fp_size_t;
+void cse::CurveEvaluator::sample_curve(const CurveSocketValue* const curve_socket_val, const int first_index, const int last_index)
+{
+	const std::vector<Float2>& curve_control_points = curve_socket_val->get_curve_points();
+
+	const int segments = static_cast<int>(samples.size()) - 1;
+	const float x_increment = 1.0f / segments;
+	float* const out = samples.data();
 
-	// sampled_points is ordered by x value
-	// do a binary search to find which two values surround the input value
-	vec_fp_size_t min_index = 0;
-	vec_fp_size_t max_index = sampled_points.size() - 1;
-	while ((max_index - min_index) > 1) {
-		const vec_fp_size_t delta = max_index - min_index;
-		const vec_fp_size_t index_to_check = min_index + delta / 2;
-		const float value_to_check = sampled_points[index_to_check].x;
-		if (in_value >= value_to_check) {
-			min_index = index_to_check;
+	// No points, in this case treat as output = input
+	if (curve_control_points.size() == 0) {
+		for (int i = first_index; i <= last_index; i++) {
+			out[i] = i * x_increment;
 		}
-		else {
-			max_index = index_to_check;
+		return;
+	}
+	// One point, this represents constant output
+	else if (curve_control_points.size() == 1) {
+		const float const_output = curve_control_points[0].y;
+		for (int i = first_index; i <= last_index; i++) {
+			out[i] = const_output;
 		}
+		return;
 	}
 
-	const Float2 point_a = sampled_points[min_index];
-	const Float2 point_b = sampled_points[max_index];
-	const float x_min = point_a.x;
-	const float x_max = point_b.x;
-	const float x_delta = x_max - x_min;
+	const bool is_hermite = curve_socket_val->get_curve_interp() == CurveInterpolation::CUBIC_HERMITE;
 
-	if (in_value < x_min) {
-		return point_a.y;
-	}
-	if (in_value > x_max) {
-		return point_b.y;
+	// If the sample is before the first control point, use the value of the first control point
+	int next_index = first_index;
+	while (next_index <= last_index && next_index * x_increment < curve_control_points.front().x) {
+		out[next_index] = curve_control_points.front().y;
+		next_index++;
 	}
 
-	const float weight_factor = (in_value - x_min) / (x_delta);
-	const float result = (1.0f - weight_factor) * point_a.y + weight_factor * point_b.y;
+	typedef std::vector<Float2>::size_type vec_fp_size_t;
+	const vec_fp_size_t final_segment_begin_index = curve_control_points.size() - 2;
+	for (vec_fp_size_t segment_begin_index = 0; segment_begin_index <= final_segment_begin_index; segment_begin_index++) {
+		if (next_index > last_index) {
+			break;
+		}
 
-	return result;
+		const Float2 point_b = curve_control_points[segment_begin_index];
+		const Float2 point_c = curve_control_points[segment_begin_index + 1];
+
+		// Every remaining sample up to and including point c belongs to this segment
+		int end_index = next_index;
+		while (end_index <= last_index && end_index * x_increment <= point_c.x) {
+			end_index++;
+		}
+		if (end_index == next_index) {
+			continue;
+		}
+
+		if (point_c.x <= point_b.x) {
+			// Both points share an x value, only samples exactly on that value can land here
+			for (int i = next_index; i < end_index; i++) {
+				out[i] = point_c.y;
+			}
+		}
+		else if (is_hermite) {
+			Float2 point_a, point_d;
+			if (segment_begin_index == 0) {
+				point_a = point_b + point_b - point_c;
+			}
+			else {
+				point_a = curve_control_points[segment_begin_index - 1];
+			}
+			if (segment_begin_index == final_segment_begin_index) {
+				point_d = point_c + point_c - point_b;
+			}
+			else {
+				point_d = curve_control_points[segment_begin_index + 2];
+			}
+			sample_hermite_segment(point_a, point_b, point_c, point_d, x_increment, next_index, end_index, out);
+		}
+		else {
+			// Default is linear
+			sample_linear_segment(point_b, point_c, x_increment, next_index, end_index, out);
+		}
+		next_index = end_index;
+	}
+
+	// If the sample is past the last control point, use the value of the last control point
+	while (next_index <= last_index) {
+		out[next_index] = curve_control_points.back().y;
+		next_index++;
+	}
 }
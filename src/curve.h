@@ -9,18 +9,24 @@ namespace cse {
 	class CurveSocketValue;
 
 	// This class is used to store the output of some curve in a format that allows for quick evaluation
-	// It will linearly interpolate between sampled values
+	// The curve is sampled into a table of evenly spaced values from x = 0 to x = 1, eval will linearly interpolate between them
 	// The curve may not have multiple points with equal X values
 	class CurveEvaluator {
 	public:
-		CurveEvaluator(CurveSocketValue* curve_socket_val, int segments = 512);
+		// segments is the number of intervals in the table, it will hold segments + 1 samples
+		CurveEvaluator(const CurveSocketValue* curve_socket_val, int segments = 512);
+		// Only samples the part of the curve from begin_x to end_x, eval should not be used outside of that range
+		CurveEvaluator(const CurveSocketValue* curve_socket_val, float begin_x, float end_x, int segments = 512);
 		CurveEvaluator(std::shared_ptr<CurveSocketValue> curve_socket_val, int segments = 512);
-		CurveEvaluator(Float2 a, Float2 b, Float2 c, Float2 d, int segments = 128);
 
-		int compare_to_range(float in_value) const;
 		float eval(float in_value) const;
 
+		// Sample i is the value of the curve at i / segments
+		const std::vector<float>& get_samples() const;
+
 	private:
-		std::vector<Float2> sampled_points;
+		void sample_curve(const CurveSocketValue* curve_socket_val, int first_index, int last_index);
+
+		std::vector<float> samples;
 	};
 }
@@ -0,0 +1,84 @@
+#include "display_list_cache.h"
+
+#include <nanovg.h>
+
+#include "wrapper_nvg_display_list.h"
+
+cse::DisplayListCache::DisplayListCache()
+{
+
+}
+
+cse::DisplayListCache::~DisplayListCache()
+{
+	// Empty destructor is needed so incomplete NvgDisplayList type can be used in the header
+}
+
+bool cse::DisplayListCache::replay_or_record(NVGcontext* const draw_context, const void* const owner, const std::uint64_t key)
+{
+	return replay_or_record(draw_context, lists[owner], key);
+}
+
+bool cse::DisplayListCache::replay_or_record(NVGcontext* const draw_context, const std::shared_ptr<const EditableNode>& node, const std::uint64_t key)
+{
+	CachedList& cached = lists[node.get()];
+	if (cached.node.lock() != node) {
+		// The node this list was recorded for no longer exists and a new node has the same address
+		cached = CachedList();
+		cached.node = node;
+	}
+	return replay_or_record(draw_context, cached, key);
+}
+
+bool cse::DisplayListCache::replay_or_record(NVGcontext* const draw_context, CachedList& cached, const std::uint64_t key)
+{
+	cached.used = true;
+
+	if (cached.list != nullptr && cached.key == key && nvgDrawDisplayList(draw_context, cached.list->list_ptr)) {
+		replayed_count++;
+		return true;
+	}
+
+	if (cached.list == nullptr) {
+		cached.list = std::make_unique<NvgDisplayList>();
+	}
+	cached.key = key;
+	recording_list = &cached;
+	recorded_count++;
+	nvgBeginDisplayList(draw_context, cached.list->list_ptr);
+	return false;
+}
+
+void cse::DisplayListCache::end_recording(NVGcontext* const draw_context)
+{
+	if (recording_list == nullptr) {
+		return;
+	}
+	nvgEndDisplayList(draw_context);
+	recording_list = nullptr;
+}
+
+void cse::DisplayListCache::remove_unused()
+{
+	for (auto iter = lists.begin(); iter != lists.end(); ) {
+		if (iter->second.used) {
+			iter->second.used = false;
+			++iter;
+		}
+		else {
+			iter = lists.erase(iter);
+		}
+	}
+	replayed_count = 0;
+	recorded_count = 0;
+}
+
+unsigned int cse::DisplayListCache::get_replayed_count() const
+{
+	return replayed_count;
+}
+
+unsigned int cse::DisplayListCache::get_recorded_count() const
+{
+	return recorded_count;
+}
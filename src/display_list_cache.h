@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+
+struct NVGcontext;
+
+namespace cse {
+
+	class EditableNode;
+	class NvgDisplayList;
+
+	// Holds recorded nanovg display lists for parts of the view that rarely change
+	// Each list belongs to one owner and is replayed for as long as the key it was recorded with stays the same
+	class DisplayListCache {
+	public:
+		DisplayListCache();
+		~DisplayListCache();
+
+		// Replays the owner's list and returns true if it was recorded with the same key
+		// Otherwise starts recording a new list for the owner and returns false, the caller must then draw normally and call end_recording
+		bool replay_or_record(NVGcontext* draw_context, const void* owner, std::uint64_t key);
+		// Same as above with a node as the owner, a list recorded for a node that has since been deleted is never replayed
+		// even if a new node is created at the same address
+		bool replay_or_record(NVGcontext* draw_context, const std::shared_ptr<const EditableNode>& node, std::uint64_t key);
+		void end_recording(NVGcontext* draw_context);
+
+		// Deletes every list that was not replayed or recorded since the last call
+		void remove_unused();
+
+		// Number of lists replayed and recorded since the last call to remove_unused
+		unsigned int get_replayed_count() const;
+		unsigned int get_recorded_count() const;
+
+	private:
+		class CachedList {
+		public:
+			std::unique_ptr<NvgDisplayList> list;
+			std::uint64_t key = 0;
+			bool used = false;
+			// Only set for lists owned by a node
+			std::weak_ptr<const EditableNode> node;
+		};
+
+		bool replay_or_record(NVGcontext* draw_context, CachedList& cached, std::uint64_t key);
+
+		std::map<const void*, CachedList> lists;
+		CachedList* recording_list = nullptr;
+
+		unsigned int replayed_count = 0;
+		unsigned int recorded_count = 0;
+	};
+
+}
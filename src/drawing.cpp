@@ -1,12 +1,15 @@
 #include "drawing.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <iomanip>
 #include <sstream>
 
 #include <nanovg.h>
 
 #include "gui_sizes.h"
+#include "node_body_shapes.h"
 #include "sockets.h"
 #include "util_area.h"
 #include "util_enum.h"
@@ -123,61 +126,142 @@ void cse::Drawing::draw_color_pick_cursor(NVGcontext* const draw_context, const
 	nvgStroke(draw_context);
 }
 
-float cse::Drawing::draw_node(
+// Horizontal distance from each end of a connection curve to its nearest control point
+static float get_connection_control_distance(const cse::Float2 begin_pos, const cse::Float2 end_pos)
+{
+	return fabs(end_pos.x - begin_pos.x) / 2.0f;
+}
+
+// Returns true if the value shown in the socket's label is different from the one the cached label was built from
+static bool label_value_changed(const cse::NodeSocket& socket)
+{
+	using cse::SocketType;
+
+	const cse::SocketLabelCache& label = socket.label_cache;
+	if (socket.socket_type == SocketType::FLOAT) {
+		const auto float_val = dynamic_cast<cse::FloatSocketValue*>(socket.value.get());
+		return float_val != nullptr && float_val->get_value() != label.float_value;
+	}
+	else if (socket.socket_type == SocketType::INT) {
+		const auto int_val = dynamic_cast<cse::IntSocketValue*>(socket.value.get());
+		return int_val != nullptr && int_val->get_value() != label.int_value;
+	}
+	else if (socket.socket_type == SocketType::BOOLEAN) {
+		const auto bool_val = dynamic_cast<cse::BoolSocketValue*>(socket.value.get());
+		return bool_val != nullptr && bool_val->value != label.bool_value;
+	}
+	// Labels for all other types never show the value
+	return false;
+}
+
+// Builds the text that will be used on this socket's label, if the cached text is out of date
+static void update_label_text(cse::NodeSocket& socket)
+{
+	using cse::SocketType;
+
+	cse::SocketLabelCache& label = socket.label_cache;
+	if (label.text_valid && label_value_changed(socket) == false) {
+		return;
+	}
+
+	label.text_valid = true;
+	label.widths_valid = false;
+	label.label_text.clear();
+	label.text_before_crossout.clear();
+
+	if (socket.value.use_count() > 0) {
+		label.text_before_crossout = socket.display_name + ":";
+		if (socket.socket_type == SocketType::FLOAT) {
+			const auto float_val = dynamic_cast<cse::FloatSocketValue*>(socket.value.get());
+			if (float_val) {
+				label.float_value = float_val->get_value();
+				std::stringstream label_string_stream;
+				label_string_stream << socket.display_name << ": " << std::fixed << std::setprecision(3) << label.float_value;
+				label.label_text = label_string_stream.str();
+			}
+		}
+		else if (socket.socket_type == SocketType::VECTOR) {
+			if (socket.selectable == true) {
+				label.label_text = socket.display_name + ": [Vector]";
+			}
+			else {
+				label.label_text = socket.display_name;
+			}
+		}
+		else if (socket.socket_type == SocketType::COLOR) {
+			label.label_text = socket.display_name + ": ";
+		}
+		else if (socket.socket_type == SocketType::STRING_ENUM) {
+			label.label_text = socket.display_name + ": [Enum]";
+		}
+		else if (socket.socket_type == SocketType::INT) {
+			const auto int_val = dynamic_cast<cse::IntSocketValue*>(socket.value.get());
+			if (int_val) {
+				label.int_value = int_val->get_value();
+				std::stringstream label_string_stream;
+				label_string_stream << socket.display_name << ": " << label.int_value;
+				label.label_text = label_string_stream.str();
+			}
+		}
+		else if (socket.socket_type == SocketType::BOOLEAN) {
+			const auto bool_val = dynamic_cast<cse::BoolSocketValue*>(socket.value.get());
+			if (bool_val) {
+				label.bool_value = bool_val->value;
+				if (label.bool_value) {
+					label.label_text = socket.display_name + ": True";
+				}
+				else {
+					label.label_text = socket.display_name + ": False";
+				}
+			}
+		}
+		else if (socket.socket_type == SocketType::CURVE) {
+			label.label_text = socket.display_name + ": [Curve]";
+		}
+		else {
+			label.label_text = socket.display_name;
+		}
+	}
+	else {
+		label.label_text = socket.display_name;
+	}
+}
+
+// Measures the label's text, if it has not been measured since the text last changed
+// This uses the current font settings, which must match the ones the label will be drawn with
+static void update_label_widths(NVGcontext* const draw_context, cse::SocketLabelCache& label)
+{
+	if (label.widths_valid) {
+		return;
+	}
+	label.widths_valid = true;
+
+	// Output is [xmin, ymin, xmax, ymax]
+	float bounds[4];
+	nvgTextBounds(draw_context, 0.0f, 0.0f, label.label_text.c_str(), nullptr, bounds);
+	label.label_min_x = bounds[0];
+	label.label_max_x = bounds[2];
+	nvgTextBounds(draw_context, 0.0f, 0.0f, label.text_before_crossout.c_str(), nullptr, bounds);
+	label.before_crossout_width = bounds[2] - bounds[0];
+}
+
+void cse::Drawing::draw_node(
 	NVGcontext* const draw_context,
+	NodeBodyShapes& body_shapes,
 	const char* const title,
 	const Float3 header_color,
 	const float node_width,
-	const Float2 world_pos,
+	const float node_height,
 	const bool selected,
 	const std::vector<std::shared_ptr<NodeSocket>>& socket_vec,
-	const std::shared_ptr<cse::NodeSocket>& selected_socket,
-	std::vector<HolderArea<std::weak_ptr<NodeSocket>>>& socket_targets,
-	std::vector<HolderArea<std::weak_ptr<NodeSocket>>>& label_targets
+	const std::shared_ptr<cse::NodeSocket>& selected_socket
 	)
 {
-	socket_targets.clear();
-	label_targets.clear();
-
 	const float draw_pos_x = 0.0f;
-	float draw_pos_y = 0.0f;
-
-	const float node_height = socket_vec.size() * UI_NODE_SOCKET_ROW_HEIGHT + UI_NODE_BOTTOM_PADDING;
+	const float draw_pos_y = 0.0f;
 
 	// Draw window
-	nvgBeginPath(draw_context);
-	nvgRoundedRect(draw_context, draw_pos_x, draw_pos_y, node_width, node_height + UI_NODE_HEADER_HEIGHT, UI_NODE_CORNER_RADIUS);
-	nvgFillColor(draw_context, nvgRGBA(180, 180, 180, 255));
-	nvgFill(draw_context);
-
-	// Draw header
-	{
-		const float rect_pos_y = draw_pos_y + UI_NODE_HEADER_HEIGHT - UI_NODE_CORNER_RADIUS;
-		nvgBeginPath(draw_context);
-		nvgRoundedRect(draw_context, draw_pos_x, draw_pos_y, node_width, UI_NODE_HEADER_HEIGHT, UI_NODE_CORNER_RADIUS);
-		nvgRect(draw_context, draw_pos_x, rect_pos_y, node_width, UI_NODE_CORNER_RADIUS);
-		nvgFillColor(draw_context, header_color);
-		nvgFill(draw_context);
-	}
-
-	nvgBeginPath(draw_context);
-	nvgMoveTo(draw_context, draw_pos_x, UI_NODE_HEADER_HEIGHT);
-	nvgLineTo(draw_context, draw_pos_x + node_width, UI_NODE_HEADER_HEIGHT);
-	nvgStrokeColor(draw_context, nvgRGBA(0, 0, 0, 225));
-	nvgStrokeWidth(draw_context, 1.3f);
-	nvgStroke(draw_context);
-
-	// Draw border
-	nvgBeginPath(draw_context);
-	nvgRoundedRect(draw_context, draw_pos_x, draw_pos_y, node_width, node_height + UI_NODE_HEADER_HEIGHT, UI_NODE_CORNER_RADIUS);
-	if (selected) {
-		nvgStrokeColor(draw_context, nvgRGBA(255, 255, 255, 225));
-	}
-	else {
-		nvgStrokeColor(draw_context, nvgRGBA(0, 0, 0, 225));
-	}
-	nvgStrokeWidth(draw_context, 1.5f);
-	nvgStroke(draw_context);
+	body_shapes.draw_body(draw_context, node_width, node_height, header_color, selected);
 
 	// Title
 	nvgFontSize(draw_context, UI_FONT_SIZE_NORMAL);
@@ -187,68 +271,13 @@ float cse::Drawing::draw_node(
 	nvgFillColor(draw_context, nvgRGBA(0, 0, 0, 255));
 	nvgText(draw_context, draw_pos_x + node_width / 2, draw_pos_y + UI_NODE_HEADER_HEIGHT / 2, title, nullptr);
 
-	float next_draw_y = draw_pos_y + UI_NODE_HEADER_HEIGHT + 2.0f;
 	// Sockets
 	for (const auto this_socket : socket_vec) {
-		// Generate the text that will be used on this socket's label
-		std::string label_text;
-		std::string text_before_crossout; // For measuring text size later
-		if (this_socket->value.use_count() > 0) {
-			text_before_crossout = this_socket->display_name + ":";
-			if (this_socket->socket_type == SocketType::FLOAT) {
-				const std::shared_ptr<FloatSocketValue> float_val = std::dynamic_pointer_cast<FloatSocketValue>(this_socket->value);
-				if (float_val) {
-					std::stringstream label_string_stream;
-					label_string_stream << this_socket->display_name << ": " << std::fixed << std::setprecision(3) << float_val->get_value();
-					label_text = label_string_stream.str();
-				}
-			}
-			else if (this_socket->socket_type == SocketType::VECTOR) {
-				if (this_socket->selectable == true) {
-					label_text = this_socket->display_name + ": [Vector]";
-				}
-				else {
-					label_text = this_socket->display_name;
-				}
-			}
-			else if (this_socket->socket_type == SocketType::COLOR) {
-				std::stringstream label_string_stream;
-				label_string_stream << this_socket->display_name << ": ";
-				label_text = label_string_stream.str();
-			}
-			else if (this_socket->socket_type == SocketType::STRING_ENUM) {
-				label_text = this_socket->display_name + ": [Enum]";
-			}
-			else if (this_socket->socket_type == SocketType::INT) {
-				const std::shared_ptr<IntSocketValue> int_val = std::dynamic_pointer_cast<IntSocketValue>(this_socket->value);
-				if (int_val) {
-					std::stringstream label_string_stream;
-					label_string_stream << this_socket->display_name << ": " << std::fixed << std::setprecision(3) << int_val->get_value();
-					label_text = label_string_stream.str();
-				}
-			}
+		// Each socket's row is centered vertically on its connector
+		const float next_draw_y = draw_pos_y + this_socket->local_position.y - UI_NODE_SOCKET_ROW_HEIGHT / 2;
 
-			else if (this_socket->socket_type == SocketType::BOOLEAN) {
-				const std::shared_ptr<BoolSocketValue> bool_val = std::dynamic_pointer_cast<BoolSocketValue>(this_socket->value);
-				if (bool_val) {
-					if (bool_val->value) {
-						label_text = this_socket->display_name + ": True";
-					}
-					else {
-						label_text = this_socket->display_name + ": False";
-					}
-				}
-			}
-			else if (this_socket->socket_type == SocketType::CURVE) {
-				label_text = this_socket->display_name + ": [Curve]";
-			}
-			else {
-				label_text = this_socket->display_name;
-			}
-		}
-		else {
-			label_text = this_socket->display_name;
-		}
+		SocketLabelCache& label = this_socket->label_cache;
+		update_label_text(*this_socket);
 
 		// Draw highlight if this node is selected
 		if (this_socket == selected_socket) {
@@ -270,13 +299,12 @@ float cse::Drawing::draw_node(
 			const float SWATCH_WIDTH = 24.0f;
 			const float SWATCH_CORNER_RADIUS = 8.0f;
 
-			float bounds[4];
-			nvgTextBounds(draw_context, 0.0f, 0.0f, label_text.c_str(), nullptr, bounds);
-			const float label_width = bounds[2] - bounds[0];
+			update_label_widths(draw_context, label);
+			const float label_width = label.label_max_x - label.label_min_x;
 
 			const float text_pos_x = draw_pos_x + node_width / 2 - SWATCH_WIDTH / 2;
 			const float text_pos_y = next_draw_y + UI_NODE_SOCKET_ROW_HEIGHT / 2;
-			nvgText(draw_context, text_pos_x, text_pos_y, label_text.c_str(), nullptr);
+			nvgText(draw_context, text_pos_x, text_pos_y, label.label_text.c_str(), nullptr);
 
 			const Float3 swatch_color = dynamic_cast<ColorSocketValue*>(this_socket->value.get())->get_value();
 
@@ -291,7 +319,7 @@ float cse::Drawing::draw_node(
 			nvgStrokeColor(draw_context, nvgRGBA(0, 0, 0, 255));
 			nvgStroke(draw_context);
 
-			if (this_socket->input_connected_this_frame && this_socket->value.use_count() > 0) {
+			if (this_socket->is_connected() && this_socket->value.use_count() > 0) {
 				const float x1 = swatch_pos_x - 3.0f;
 				const float x2 = swatch_pos_x + SWATCH_WIDTH + 3.0f;
 				const float y = swatch_pos_y + SWATCH_HEIGHT / 2.0f;
@@ -300,59 +328,29 @@ float cse::Drawing::draw_node(
 				nvgLineTo(draw_context, x2, y);
 				nvgStrokeWidth(draw_context, 1.2f);
 				nvgStroke(draw_context);
-				this_socket->input_connected_this_frame = false;
 			}
 		}
 		else {
 			const float text_pos_x = draw_pos_x + node_width / 2;
 			const float text_pos_y = next_draw_y + UI_NODE_SOCKET_ROW_HEIGHT / 2;
-			nvgText(draw_context, text_pos_x, text_pos_y, label_text.c_str(), nullptr);
-			if (this_socket->input_connected_this_frame && this_socket->value.use_count() > 0) {
-				// Output is [xmin, ymin, xmax, ymax]
-				float full_size[4];
-				float short_size[4];
-				nvgTextBounds(draw_context, text_pos_x, text_pos_y, label_text.c_str(), nullptr, full_size);
-				nvgTextBounds(draw_context, text_pos_x, text_pos_y, text_before_crossout.c_str(), nullptr, short_size);
-				const float short_width = short_size[2] - short_size[0];
-				const float x1 = full_size[0] + short_width + 1.0f;
-				const float x2 = full_size[2] + 2.0f;
+			nvgText(draw_context, text_pos_x, text_pos_y, label.label_text.c_str(), nullptr);
+			if (this_socket->is_connected() && this_socket->value.use_count() > 0) {
+				update_label_widths(draw_context, label);
+				const float x1 = text_pos_x + label.label_min_x + label.before_crossout_width + 1.0f;
+				const float x2 = text_pos_x + label.label_max_x + 2.0f;
 				nvgBeginPath(draw_context);
 				nvgMoveTo(draw_context, x1, text_pos_y);
 				nvgLineTo(draw_context, x2, text_pos_y);
 				nvgStrokeWidth(draw_context, 1.2f);
 				nvgStroke(draw_context);
-				this_socket->input_connected_this_frame = false;
 			}
 		}
 
-		if (this_socket->selectable) {
-			// Add label click target
-			const Float2 click_target_begin(0, next_draw_y - draw_pos_y);
-			const Float2 click_target_end(node_width, next_draw_y - draw_pos_y + UI_NODE_SOCKET_ROW_HEIGHT);
-			const HolderArea<std::weak_ptr<NodeSocket>> label_target(click_target_begin, click_target_end, this_socket);
-			label_targets.push_back(label_target);
-		}
-
 		if (this_socket->draw_socket) {
-			Float2 socket_position;
-			if (this_socket->io_type == SocketIOType::INPUT) {
-				socket_position = Float2(draw_pos_x, next_draw_y + UI_NODE_SOCKET_ROW_HEIGHT / 2);
-			}
-			else {
-				socket_position = Float2(draw_pos_x + node_width, next_draw_y + UI_NODE_SOCKET_ROW_HEIGHT / 2);
-			}
+			const Float2 socket_position = Float2(draw_pos_x, draw_pos_y) + this_socket->local_position;
 			nvgBeginPath(draw_context);
 			nvgCircle(draw_context, socket_position.x, socket_position.y, UI_NODE_SOCKET_RADIUS);
 
-			this_socket->world_draw_position = world_pos + socket_position;
-
-			// Add click target for this socket
-			Float2 local_socket_position(socket_position.x - draw_pos_x, socket_position.y - draw_pos_y);
-			Float2 click_target_begin(local_socket_position.x - 7.0f, local_socket_position.y - 7.0f);
-			Float2 click_target_end(local_socket_position.x + 7.0f, local_socket_position.y + 7.0f);
-			const HolderArea<std::weak_ptr<NodeSocket>> socket_target(click_target_begin, click_target_end, this_socket);
-			socket_targets.push_back(socket_target);
-
 			if (this_socket->socket_type == SocketType::CLOSURE) {
 				nvgFillColor(draw_context, nvgRGBA(100, 200, 100, 255));
 			}
@@ -378,11 +376,7 @@ float cse::Drawing::draw_node(
 			nvgStrokeWidth(draw_context, 1.0f);
 			nvgStroke(draw_context);
 		}
-
-		next_draw_y += UI_NODE_SOCKET_ROW_HEIGHT;
 	}
-
-	return node_height;
 }
 
 void cse::Drawing::draw_node_connection_curve(
@@ -391,20 +385,96 @@ void cse::Drawing::draw_node_connection_curve(
 	const Float2 end_pos,
 	const float width
 	)
+{
+	nvgBeginPath(draw_context);
+	add_node_connection_curve(draw_context, begin_pos, end_pos);
+	stroke_node_connections(draw_context, width);
+}
+
+void cse::Drawing::add_node_connection_curve(NVGcontext* const draw_context, const Float2 begin_pos, const Float2 end_pos)
 {
 	const float source_x = begin_pos.x;
 	const float source_y = begin_pos.y;
 	const float dest_x = end_pos.x;
 	const float dest_y = end_pos.y;
 
-	const float c_distance = fabs(dest_x - source_x) / 2.0f;
+	const float c_distance = get_connection_control_distance(begin_pos, end_pos);
 	const float c1_x = source_x + c_distance;
 	const float c2_x = dest_x - c_distance;
 
-	nvgBeginPath(draw_context);
 	nvgMoveTo(draw_context, source_x, source_y);
 	nvgBezierTo(draw_context, c1_x, source_y, c2_x, dest_y, dest_x, dest_y);
+}
+
+void cse::Drawing::add_node_connection_line(NVGcontext* const draw_context, const Float2 begin_pos, const Float2 end_pos)
+{
+	nvgMoveTo(draw_context, begin_pos.x, begin_pos.y);
+	nvgLineTo(draw_context, end_pos.x, end_pos.y);
+}
+
+void cse::Drawing::add_node_connection_polyline(NVGcontext* const draw_context, const std::vector<Float2>& points)
+{
+	if (points.empty()) {
+		return;
+	}
+	nvgMoveTo(draw_context, points[0]);
+	for (std::size_t i = 1; i < points.size(); i++) {
+		nvgLineTo(draw_context, points[i]);
+	}
+}
+
+void cse::Drawing::stroke_node_connections(NVGcontext* const draw_context, const float width)
+{
 	nvgStrokeColor(draw_context, nvgRGBA(255, 255, 255, 255));
 	nvgStrokeWidth(draw_context, width);
 	nvgStroke(draw_context);
+}
+
+void cse::Drawing::flatten_node_connection_curve(const Float2 begin_pos, const Float2 end_pos, const float zoom_scale, std::vector<Float2>& points)
+{
+	// Segments about this long on screen, in pixels, are short enough that the curve looks smooth
+	constexpr float SEGMENT_LENGTH_PX = 6.0f;
+	constexpr int MIN_SEGMENTS = 4;
+	constexpr int MAX_SEGMENTS = 64;
+
+	const float c_distance = get_connection_control_distance(begin_pos, end_pos);
+	const Float2 c1(begin_pos.x + c_distance, begin_pos.y);
+	const Float2 c2(end_pos.x - c_distance, end_pos.y);
+
+	// Length of the control polygon is never shorter than the curve
+	const float polygon_length =
+		std::sqrt((c1 - begin_pos).magnitude_squared()) +
+		std::sqrt((c2 - c1).magnitude_squared()) +
+		std::sqrt((end_pos - c2).magnitude_squared());
+	const int segments = std::max(MIN_SEGMENTS, std::min(MAX_SEGMENTS, static_cast<int>(std::ceil(polygon_length * zoom_scale / SEGMENT_LENGTH_PX))));
+
+	points.clear();
+	points.reserve(segments + 1);
+	for (int i = 0; i <= segments; i++) {
+		const float t = static_cast<float>(i) / segments;
+		const float u = 1.0f - t;
+		const float w0 = u * u * u;
+		const float w1 = 3.0f * u * u * t;
+		const float w2 = 3.0f * u * t * t;
+		const float w3 = t * t * t;
+		points.push_back(Float2(
+			w0 * begin_pos.x + w1 * c1.x + w2 * c2.x + w3 * end_pos.x,
+			w0 * begin_pos.y + w1 * c1.y + w2 * c2.y + w3 * end_pos.y
+		));
+	}
+}
+
+cse::Area cse::Drawing::get_node_connection_curve_bounds(const Float2 begin_pos, const Float2 end_pos, const float width)
+{
+	const float c_distance = get_connection_control_distance(begin_pos, end_pos);
+	const float c1_x = begin_pos.x + c_distance;
+	const float c2_x = end_pos.x - c_distance;
+
+	const float half_width = width / 2.0f;
+	const float min_x = std::min(std::min(begin_pos.x, end_pos.x), std::min(c1_x, c2_x)) - half_width;
+	const float max_x = std::max(std::max(begin_pos.x, end_pos.x), std::max(c1_x, c2_x)) + half_width;
+	const float min_y = std::min(begin_pos.y, end_pos.y) - half_width;
+	const float max_y = std::max(begin_pos.y, end_pos.y) + half_width;
+
+	return Area(Float2(min_x, min_y), Float2(max_x, max_y));
 }
\ No newline at end of file
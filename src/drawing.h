@@ -13,6 +13,7 @@ namespace cse {
 
 	class Float2;
 	class Float3;
+	class NodeBodyShapes;
 	class NodeSocket;
 
 	namespace Drawing {
@@ -23,19 +24,28 @@ namespace cse {
 		void draw_color_pick_cursor(NVGcontext* draw_context, Float2 pos);
 
 		// Node Graph View
-		float draw_node(
+		// Socket rows are placed using each socket's local_position, which must already be set by the node's layout pass
+		void draw_node(
 			NVGcontext* draw_context,
+			NodeBodyShapes& body_shapes,
 			const char* title,
 			Float3 header_color,
 			float node_width,
-			Float2 world_pos,
+			float node_height,
 			bool selected,
 			const std::vector<std::shared_ptr<NodeSocket>>& socket_vec,
-			const std::shared_ptr<cse::NodeSocket>& selected_socket,
-			std::vector<HolderArea<std::weak_ptr<NodeSocket>>>& socket_targets,
-			std::vector<HolderArea<std::weak_ptr<NodeSocket>>>& label_targets
+			const std::shared_ptr<cse::NodeSocket>& selected_socket
 		);
 		void draw_node_connection_curve(NVGcontext* draw_context, Float2 begin_pos, Float2 end_pos, float width);
+		// Batched connections, any number of connections can be added to the current path then stroked together in one draw call
+		void add_node_connection_curve(NVGcontext* draw_context, Float2 begin_pos, Float2 end_pos);
+		void add_node_connection_line(NVGcontext* draw_context, Float2 begin_pos, Float2 end_pos);
+		void add_node_connection_polyline(NVGcontext* draw_context, const std::vector<Float2>& points);
+		void stroke_node_connections(NVGcontext* draw_context, float width);
+		// Evaluates a connection curve as a series of points spaced closely enough to look smooth at the given zoom
+		void flatten_node_connection_curve(Float2 begin_pos, Float2 end_pos, float zoom_scale, std::vector<Float2>& points);
+		// Bounds of the curve's control points, which always contain the whole curve
+		Area get_node_connection_curve_bounds(Float2 begin_pos, Float2 end_pos, float width);
 
 	}
 }
@@ -51,6 +51,7 @@ void cse::EditableGraph::add_connection(const std::weak_ptr<NodeSocket> socket_b
 	should_push_undo_state = true;
 	NodeConnection new_connection(socket_begin, socket_end);
 	connections.push_back(new_connection);
+	socket_end.lock()->connected_count++;
 }
 
 cse::NodeConnection cse::EditableGraph::remove_connection_with_end(const std::weak_ptr<NodeSocket> socket_end)
@@ -59,12 +60,14 @@ cse::NodeConnection cse::EditableGraph::remove_connection_with_end(const std::we
 	if (socket_end.expired()) {
 		return default_result;
 	}
+	const std::shared_ptr<NodeSocket> socket_end_ptr = socket_end.lock();
 	std::list<NodeConnection>::iterator iter;
 	for (iter = connections.begin(); iter != connections.end(); iter++) {
-		if (iter->end_socket.lock() == socket_end.lock()) {
+		if (iter->end_socket.lock() == socket_end_ptr) {
 			should_push_undo_state = true;
 			NodeConnection result = *iter;
 			connections.erase(iter);
+			socket_end_ptr->connected_count--;
 			return result;
 		}
 	}
@@ -84,6 +87,8 @@ void cse::EditableGraph::remove_node_set(const cse::WeakNodeSet& weak_nodes_to_r
 	while (node_iter != nodes.end()) {
 		auto this_node = *node_iter;
 		if (this_node->can_be_deleted() && shared_nodes_to_remove.count(this_node) == 1) {
+			// Nodes in shared_nodes_to_remove are still alive here so their connections must be removed explicitly
+			remove_connections_with_node(this_node.get());
 			node_iter = nodes.erase(node_iter);
 			should_push_undo_state = true;
 		}
@@ -194,6 +199,22 @@ void cse::EditableGraph::reset(const ShaderGraphType type)
 	}
 }
 
+void cse::EditableGraph::remove_connections_with_node(EditableNode* const node)
+{
+	std::list<NodeConnection>::iterator iter = connections.begin();
+	while (iter != connections.end()) {
+		if (iter->includes_node(node)) {
+			if (const auto end_socket_ptr = iter->end_socket.lock()) {
+				end_socket_ptr->connected_count--;
+			}
+			iter = connections.erase(iter);
+		}
+		else {
+			iter++;
+		}
+	}
+}
+
 void cse::EditableGraph::remove_invalid_connections()
 {
 	std::list<NodeConnection>::iterator iter = connections.begin();
@@ -202,6 +223,10 @@ void cse::EditableGraph::remove_invalid_connections()
 			iter++;
 		}
 		else {
+			// If only the beginning was removed the end socket still exists and needs to know it is no longer connected
+			if (const auto end_socket_ptr = iter->end_socket.lock()) {
+				end_socket_ptr->connected_count--;
+			}
 			iter = connections.erase(iter);
 		}
 	}
@@ -39,6 +39,7 @@ namespace cse {
 	private:
 		void reset(ShaderGraphType type);
 
+		void remove_connections_with_node(EditableNode* node);
 		void remove_invalid_connections();
 
 		bool should_push_undo_state = false;
@@ -0,0 +1,89 @@
+#include "font_atlas_cache.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <nanovg.h>
+
+#include "gui_sizes.h"
+#include "util_hash.h"
+
+// Bump this when anything about prewarm changes so old cache files are not used
+static constexpr char CACHE_MAGIC[8] = { 'C', 'S', 'E', 'F', 'N', 'T', '0', '2' };
+
+struct CacheHeader {
+	char magic[8];
+	std::uint64_t font_hash;
+};
+
+static std::string get_prewarm_text()
+{
+	std::string result;
+	for (char c = 0x20; c < 0x7f; c++) {
+		result.push_back(c);
+	}
+	return result;
+}
+
+void cse::FontAtlasCache::prewarm(NVGcontext* const draw_context, const char* const font_name)
+{
+	const std::string text = get_prewarm_text();
+
+	// Window size does not matter here, nothing is drawn
+	// Text is rendered as distance fields that are rasterized once at a fixed size, so one pass covers every zoom level and px_ratio
+	nvgBeginFrame(draw_context, 1.0f, 1.0f, 1.0f);
+	nvgFontSize(draw_context, UI_FONT_SIZE_NORMAL);
+	nvgFontFace(draw_context, font_name);
+	nvgPrewarmText(draw_context, text.c_str(), nullptr);
+	nvgCancelFrame(draw_context);
+}
+
+bool cse::FontAtlasCache::get_font_hash(const PathString& font_path, std::uint64_t& hash)
+{
+	std::vector<unsigned char> font_data;
+	if (Platform::read_file(font_path, font_data) == false) {
+		return false;
+	}
+
+	hash = HASH_SEED;
+	hash_bytes(hash, font_data.data(), font_data.size());
+	return true;
+}
+
+bool cse::FontAtlasCache::load(NVGcontext* const draw_context, const PathString& cache_path, const std::uint64_t font_hash)
+{
+	std::vector<unsigned char> cache_data;
+	if (Platform::read_file(cache_path, cache_data) == false || cache_data.size() < sizeof(CacheHeader)) {
+		return false;
+	}
+
+	CacheHeader header = CacheHeader();
+	std::memcpy(&header, cache_data.data(), sizeof(CacheHeader));
+	if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.font_hash != font_hash) {
+		return false;
+	}
+
+	const unsigned char* const atlas_data = cache_data.data() + sizeof(CacheHeader);
+	const int atlas_size = static_cast<int>(cache_data.size() - sizeof(CacheHeader));
+	return nvgLoadFontCache(draw_context, atlas_data, atlas_size) != 0;
+}
+
+bool cse::FontAtlasCache::save(NVGcontext* const draw_context, const PathString& cache_path, const std::uint64_t font_hash)
+{
+	const int atlas_size = nvgFontCacheSize(draw_context);
+	if (atlas_size <= 0) {
+		return false;
+	}
+
+	CacheHeader header = CacheHeader();
+	std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+	header.font_hash = font_hash;
+
+	std::vector<unsigned char> cache_data(sizeof(CacheHeader) + atlas_size);
+	std::memcpy(cache_data.data(), &header, sizeof(CacheHeader));
+	if (nvgSaveFontCache(draw_context, cache_data.data() + sizeof(CacheHeader), atlas_size) == 0) {
+		return false;
+	}
+	return Platform::write_file(cache_path, cache_data);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+#include "util_platform.h"
+
+struct NVGcontext;
+
+namespace cse {
+
+	// Keeps glyph rasterization out of the first frames after the editor starts
+	namespace FontAtlasCache {
+		// Rasterizes every printable ASCII glyph
+		// Must be called outside of a frame
+		void prewarm(NVGcontext* draw_context, const char* font_name);
+
+		// Cache files are keyed by a hash of the font file contents
+		// Returns false if the font could not be read
+		bool get_font_hash(const PathString& font_path, std::uint64_t& hash);
+
+		// Returns false if the cache does not exist or was written for a different font or build
+		bool load(NVGcontext* draw_context, const PathString& cache_path, std::uint64_t font_hash);
+		bool save(NVGcontext* draw_context, const PathString& cache_path, std::uint64_t font_hash);
+	}
+
+}
@@ -64,3 +64,20 @@ void cse::scroll_callback(GLFWwindow* const window, const double xoffset, const
 		main_window->handle_scroll(xoffset, yoffset);
 	}
 }
+
+void cse::window_refresh_callback(GLFWwindow* const window)
+{
+	EditorMainWindow* const main_window = get_main_window(window);
+	if (main_window != nullptr) {
+		main_window->request_redraw();
+	}
+}
+
+void cse::window_focus_callback(GLFWwindow* const window, const int /*focused*/)
+{
+	// The window is not drawn while unfocused, so it may be out of date when focus returns
+	EditorMainWindow* const main_window = get_main_window(window);
+	if (main_window != nullptr) {
+		main_window->request_redraw();
+	}
+}
@@ -14,4 +14,7 @@ namespace cse {
 	void character_callback(GLFWwindow* window, unsigned int codepoint);
 	void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
 
+	void window_refresh_callback(GLFWwindow* window);
+	void window_focus_callback(GLFWwindow* window, int focused);
+
 }
@@ -19,6 +19,11 @@ void cse::GraphEditor::set_font_search_path(const PathString& font_path)
 	main_window->set_font_search_path(font_path);
 }
 
+void cse::GraphEditor::set_font_atlas_cache_path(const PathString& cache_path)
+{
+	main_window->set_font_atlas_cache_path(cache_path);
+}
+
 bool cse::GraphEditor::create_window()
 {
 	return main_window->create_window();
@@ -34,6 +39,36 @@ void cse::GraphEditor::set_target_frame_rate(const double fps)
 	main_window->set_target_frame_rate(fps);
 }
 
+void cse::GraphEditor::set_event_driven_redraw(const bool enabled)
+{
+	main_window->set_event_driven_redraw(enabled);
+}
+
+void cse::GraphEditor::set_event_wait_timeout(const double seconds)
+{
+	main_window->set_event_wait_timeout(seconds);
+}
+
+void cse::GraphEditor::request_redraw()
+{
+	main_window->request_redraw();
+}
+
+unsigned long long cse::GraphEditor::get_skipped_frame_count() const
+{
+	return main_window->get_skipped_frame_count();
+}
+
+std::string cse::GraphEditor::get_draw_stats() const
+{
+	return main_window->get_draw_stats();
+}
+
+void cse::GraphEditor::set_dynamic_resolution(const float interaction_scale, const double frame_time_threshold_ms)
+{
+	main_window->set_dynamic_resolution(interaction_scale, frame_time_threshold_ms);
+}
+
 void cse::GraphEditor::load_serialized_graph(const std::string& graph)
 {
 	main_window->load_serialized_graph(graph);
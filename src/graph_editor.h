@@ -15,12 +15,29 @@ namespace cse {
 		~GraphEditor();
 
 		void set_font_search_path(const PathString& font_path);
+		// Optional, glyphs are rasterized once and stored in this file so later launches can skip rasterization
+		// Must be set before create_window
+		void set_font_atlas_cache_path(const PathString& cache_path);
 
 		bool create_window();
 		bool run_window_loop_iteration();
 
 		void set_target_frame_rate(double fps);
 
+		// Event driven redraw is enabled by default, the window is only drawn when something has changed
+		// and run_window_loop_iteration will block for up to the wait timeout when there is nothing to do
+		void set_event_driven_redraw(bool enabled);
+		void set_event_wait_timeout(double seconds);
+		// Forces the window to be drawn on the next loop iteration
+		void request_redraw();
+		unsigned long long get_skipped_frame_count() const;
+		// Counts of what was drawn and culled in the last frame, and how many GL calls it took
+		std::string get_draw_stats() const;
+
+		// While panning or dragging, if frames take longer than the threshold the graph is drawn at a reduced resolution
+		// interaction_scale is the fraction of full resolution used, 1.0 disables this
+		void set_dynamic_resolution(float interaction_scale, double frame_time_threshold_ms);
+
 		void load_serialized_graph(const std::string& graph);
 
 		bool get_serialized_graph(std::string& graph);
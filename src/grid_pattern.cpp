@@ -0,0 +1,107 @@
+#include "grid_pattern.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <nanovg.h>
+
+#include "util_vector.h"
+
+// Spacing of the light grid lines, in world units
+static constexpr float GRID_SIZE = 36.0f;
+// Every 8th line is a darker line, the pattern image covers the area between two of them
+static constexpr float MEDIUM_GRID_SIZE = GRID_SIZE * 8;
+
+static constexpr float LIGHT_LINE_WIDTH = 1.2f;
+static constexpr float LIGHT_LINE_ALPHA = 0.28f;
+static constexpr float MEDIUM_LINE_WIDTH = 1.8f;
+static constexpr float MEDIUM_LINE_ALPHA = 0.45f;
+
+// Limits the size of the pattern image when zoomed in, beyond this the image is scaled up
+static constexpr int MAX_IMAGE_SIZE = 1024;
+
+// Light lines fade out as they get closer together on screen than this, in pixels
+static constexpr float LIGHT_LINE_FADE_BEGIN = 18.0f;
+static constexpr float LIGHT_LINE_FADE_END = 6.0f;
+
+// Fraction of a pixel covered by a line, where distance is from the pixel center to the line center
+static float get_line_coverage(const float distance, const float line_width)
+{
+	const float half_width = line_width / 2.0f;
+	const float overlap = std::min(distance + 0.5f, half_width) - std::max(distance - 0.5f, -half_width);
+	return std::max(0.0f, std::min(1.0f, overlap));
+}
+
+// Distance from a point to the nearest of a set of evenly spaced lines, one of which is at 0
+static float get_distance_to_grid_line(const float pos, const float spacing)
+{
+	const float offset = std::fmod(pos, spacing);
+	return std::min(offset, spacing - offset);
+}
+
+cse::GridPattern::GridPattern()
+{
+
+}
+
+cse::GridPattern::~GridPattern()
+{
+	if (image_context != nullptr && image >= 0) {
+		nvgDeleteImage(image_context, image);
+	}
+}
+
+void cse::GridPattern::draw(NVGcontext* const draw_context, const Float2 begin, const Float2 end, const float zoom_scale, const float px_ratio)
+{
+	if (image < 0 || zoom_scale != image_zoom_scale || px_ratio != image_px_ratio) {
+		update_image(draw_context, zoom_scale, px_ratio);
+	}
+
+	const NVGpaint grid_paint = nvgImagePattern(draw_context, 0.0f, 0.0f, MEDIUM_GRID_SIZE, MEDIUM_GRID_SIZE, 0.0f, image, 1.0f);
+	nvgBeginPath(draw_context);
+	nvgRect(draw_context, begin.x, begin.y, end.x - begin.x, end.y - begin.y);
+	nvgFillPaint(draw_context, grid_paint);
+	nvgFill(draw_context);
+}
+
+void cse::GridPattern::update_image(NVGcontext* const draw_context, const float zoom_scale, const float px_ratio)
+{
+	if (image_context != nullptr && image >= 0) {
+		nvgDeleteImage(image_context, image);
+	}
+
+	// One pixel in the image covers one pixel on screen unless that would make the image too large
+	const int image_size = std::min(MAX_IMAGE_SIZE, static_cast<int>(std::ceil(MEDIUM_GRID_SIZE * zoom_scale * px_ratio)));
+	const float pixels_per_unit = image_size / MEDIUM_GRID_SIZE;
+
+	const float light_spacing_px = GRID_SIZE * zoom_scale;
+	const float light_fade = std::max(0.0f, std::min(1.0f, (light_spacing_px - LIGHT_LINE_FADE_END) / (LIGHT_LINE_FADE_BEGIN - LIGHT_LINE_FADE_END)));
+
+	// Coverage of each column is also the coverage of the matching row, so both can share one table
+	std::vector<float> light_coverage(image_size);
+	std::vector<float> medium_coverage(image_size);
+	for (int i = 0; i < image_size; i++) {
+		const float pos = (i + 0.5f) / pixels_per_unit;
+		const float light_distance_px = get_distance_to_grid_line(pos, GRID_SIZE) * pixels_per_unit;
+		const float medium_distance_px = get_distance_to_grid_line(pos, MEDIUM_GRID_SIZE) * pixels_per_unit;
+		light_coverage[i] = get_line_coverage(light_distance_px, LIGHT_LINE_WIDTH * pixels_per_unit);
+		medium_coverage[i] = get_line_coverage(medium_distance_px, MEDIUM_LINE_WIDTH * pixels_per_unit);
+	}
+
+	std::vector<unsigned char> pixels(image_size * image_size * 4, 0);
+	for (int y = 0; y < image_size; y++) {
+		for (int x = 0; x < image_size; x++) {
+			// Horizontal and vertical lines are layered the same way overlapping strokes would be
+			const float light_alpha = LIGHT_LINE_ALPHA * light_fade * std::max(light_coverage[x], light_coverage[y]);
+			const float medium_alpha = MEDIUM_LINE_ALPHA * std::max(medium_coverage[x], medium_coverage[y]);
+			const float alpha = 1.0f - (1.0f - light_alpha) * (1.0f - medium_alpha);
+			pixels[(y * image_size + x) * 4 + 3] = static_cast<unsigned char>(alpha * 255.0f + 0.5f);
+		}
+	}
+
+	image = nvgCreateImageRGBA(draw_context, image_size, image_size, NVG_IMAGE_REPEATX | NVG_IMAGE_REPEATY, pixels.data());
+	image_context = draw_context;
+	image_zoom_scale = zoom_scale;
+	image_px_ratio = px_ratio;
+}
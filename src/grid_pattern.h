@@ -0,0 +1,29 @@
+#pragma once
+
+struct NVGcontext;
+
+namespace cse {
+
+	class Float2;
+
+	// Background grid for the node graph view
+	// The grid is drawn as a single quad filled with a repeating image, which is regenerated whenever the zoom changes
+	class GridPattern {
+	public:
+		GridPattern();
+		~GridPattern();
+
+		// Fills the area between the two world space points with the grid
+		// The current transform must map world space to the screen with the given zoom
+		void draw(NVGcontext* draw_context, Float2 begin, Float2 end, float zoom_scale, float px_ratio);
+
+	private:
+		void update_image(NVGcontext* draw_context, float zoom_scale, float px_ratio);
+
+		NVGcontext* image_context = nullptr;
+		int image = -1;
+		float image_zoom_scale = 0.0f;
+		float image_px_ratio = 0.0f;
+	};
+
+}
@@ -1,5 +1,9 @@
 #include "main_window.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <utility>
 #include <vector>
 
@@ -8,6 +12,7 @@
 #include <nanovg.h>
 
 #include "editable_graph.h"
+#include "font_atlas_cache.h"
 #include "glfw_callbacks.h"
 #include "gui_sizes.h"
 #include "node_base.h"
@@ -25,8 +30,21 @@
 #include "wrapper_glfw_func.h"
 #include "wrapper_glfw_window.h"
 #include "wrapper_nvg_context.h"
+#include "wrapper_nvg_framebuffer.h"
 #include "wrapper_nvg_func.h"
 
+static std::string get_draw_stats_string(const cse::NvgDrawStats& stats)
+{
+	constexpr unsigned char BUFFER_SIZE = 64;
+	char buf[BUFFER_SIZE];
+	const int result = snprintf(buf, BUFFER_SIZE, "GL: %d calls, %d batches, %d draws", stats.calls, stats.batches, stats.gl_draw_calls);
+	if (result <= 0) {
+		// This should never happen
+		return "GL STATS ERROR";
+	}
+	return std::string(buf);
+}
+
 cse::EditorMainWindow::EditorMainWindow() :
 	main_graph(std::make_shared<EditableGraph>(ShaderGraphType::MATERIAL))
 {
@@ -49,6 +67,11 @@ void cse::EditorMainWindow::set_font_search_path(const PathString& path)
 	font_search_path = path;
 }
 
+void cse::EditorMainWindow::set_font_atlas_cache_path(const PathString& cache_path)
+{
+	font_atlas_cache_path = cache_path;
+}
+
 bool cse::EditorMainWindow::create_window()
 {
 	if (!glfwInit()) {
@@ -83,6 +106,7 @@ bool cse::EditorMainWindow::create_window()
 
 	const PathString sans_font_path = Platform::get_font_path(font_search_path, "SourceSansPro-Regular.ttf");
 	Platform::nvg_create_font(sans_font_path, "sans", nvg_context);
+	prepare_font_atlas(sans_font_path);
 
 	register_window_pair_for_callbacks(glfw_window->window_ptr, this);
 
@@ -90,6 +114,8 @@ bool cse::EditorMainWindow::create_window()
 	glfwSetMouseButtonCallback(glfw_window, mouse_button_callback);
 	glfwSetCharCallback(glfw_window, character_callback);
 	glfwSetScrollCallback(glfw_window, scroll_callback);
+	glfwSetWindowRefreshCallback(glfw_window, window_refresh_callback);
+	glfwSetWindowFocusCallback(glfw_window, window_focus_callback);
 
 	toolbar = std::make_unique<NodeEditorToolbar>();
 	status_bar = std::make_unique<NodeEditorStatusBar>();
@@ -108,29 +134,73 @@ bool cse::EditorMainWindow::create_window()
 	return true;
 }
 
+void cse::EditorMainWindow::prepare_font_atlas(const PathString& font_path)
+{
+	std::uint64_t font_hash = 0;
+	const bool use_cache = (font_atlas_cache_path.empty() == false) && FontAtlasCache::get_font_hash(font_path, font_hash);
+	if (use_cache && FontAtlasCache::load(nvg_context->context_ptr, font_atlas_cache_path, font_hash)) {
+		return;
+	}
+
+	FontAtlasCache::prewarm(nvg_context->context_ptr, "sans");
+	if (use_cache) {
+		FontAtlasCache::save(nvg_context->context_ptr, font_atlas_cache_path, font_hash);
+	}
+}
+
 bool cse::EditorMainWindow::run_window_loop_iteration()
 {
 	if (glfwWindowShouldClose(glfw_window)) {
 		return false;
 	}
 
+	if (event_driven_redraw && (redraw_requested == false || should_draw_window() == false)) {
+		// Nothing to draw yet, sleep until there is input or the timeout expires
+		glfwWaitEventsTimeout(event_wait_timeout);
+	}
+
 	pre_draw();
 
+	if (event_driven_redraw) {
+		if (redraw_requested == false || should_draw_window() == false) {
+			skipped_frame_count++;
+			return true;
+		}
+		redraw_requested = false;
+	}
+
+	const auto frame_begin_time = std::chrono::steady_clock::now();
+
 	int fb_width, fb_height;
 	glfwGetFramebufferSize(glfw_window, &fb_width, &fb_height);
 	const float px_ratio = static_cast<float>(fb_width) / window_width;
 
+	update_view_resolution_scale();
+	status_bar->set_resolution_scale(view_resolution_scale);
+
+	nvg_context->reset_draw_stats();
+
+	// These render to offscreen framebuffers, so they must happen before the window's frame begins
+	view->prepare_draw(nvg_context->context_ptr, px_ratio);
+	const bool view_drawn_offscreen = draw_view_offscreen(fb_width, fb_height, px_ratio);
+
 	glViewport(0, 0, fb_width, fb_height);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
 	const float window_width_fl = static_cast<float>(window_width);
 	const float window_height_fl = static_cast<float>(window_height);
 	nvgBeginFrame(nvg_context, window_width_fl, window_height_fl, px_ratio);
-	draw();
+	draw(view_drawn_offscreen);
 	nvgEndFrame(nvg_context);
 
+	draw_stats_text = get_draw_stats_string(nvg_context->get_draw_stats());
+
+	const std::chrono::duration<double> draw_duration = std::chrono::steady_clock::now() - frame_begin_time;
+
 	swap_buffers();
 
+	last_frame_time = draw_duration.count() + last_swap_time;
+
 	return true;
 }
 
@@ -139,8 +209,42 @@ void cse::EditorMainWindow::set_target_frame_rate(const double fps)
 	target_frame_rate = fps;
 }
 
+void cse::EditorMainWindow::set_event_driven_redraw(const bool enabled)
+{
+	event_driven_redraw = enabled;
+	redraw_requested = true;
+}
+
+void cse::EditorMainWindow::set_event_wait_timeout(const double seconds)
+{
+	event_wait_timeout = seconds;
+}
+
+void cse::EditorMainWindow::request_redraw()
+{
+	redraw_requested = true;
+}
+
+unsigned long long cse::EditorMainWindow::get_skipped_frame_count() const
+{
+	return skipped_frame_count;
+}
+
+std::string cse::EditorMainWindow::get_draw_stats() const
+{
+	return view->get_draw_counts_string() + "  " + draw_stats_text;
+}
+
+void cse::EditorMainWindow::set_dynamic_resolution(const float interaction_scale, const double frame_time_threshold_ms)
+{
+	interaction_resolution_scale = interaction_scale;
+	interaction_frame_time_threshold = frame_time_threshold_ms / 1000.0;
+}
+
 void cse::EditorMainWindow::handle_mouse_button(const int button, const int action, const int mods)
 {
+	request_redraw();
+
 	// Clicking anywhere will deselect any input box
 	if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS) {
 		for (const auto& this_subwindow : subwindows) {
@@ -173,6 +277,8 @@ void cse::EditorMainWindow::handle_mouse_button(const int button, const int acti
 
 void cse::EditorMainWindow::handle_key(const int key, const int scancode, const int action, const int mods)
 {
+	request_redraw();
+
 	// Global shortcuts that should be handled with greater priority than anything else
 	if (mods == GLFW_MOD_CONTROL && action == GLFW_PRESS) {
 		switch (key) {
@@ -227,11 +333,14 @@ void cse::EditorMainWindow::handle_key(const int key, const int scancode, const
 
 void cse::EditorMainWindow::handle_character(const unsigned int codepoint)
 {
+	request_redraw();
 	forward_character_to_subwindow(codepoint);
 }
 
 void cse::EditorMainWindow::handle_scroll(const double /*xoffset*/, const double yoffset)
 {
+	request_redraw();
+
 	if (yoffset > 0.1) {
 		requests.view.zoom_in = true;
 	}
@@ -245,6 +354,7 @@ void cse::EditorMainWindow::load_serialized_graph(const std::string& graph_str)
 	clear_graph(true);
 	deserialize_graph(graph_str, this->main_graph->nodes, this->main_graph->connections);
 	update_serialized_state();
+	request_redraw();
 }
 
 bool cse::EditorMainWindow::get_serialized_output(std::string& graph) {
@@ -274,10 +384,19 @@ void cse::EditorMainWindow::pre_draw()
 	}
 
 	// Get new mouse position and window size
-	double mx, my;
-	glfwGetCursorPos(glfw_window, &mx, &my);
-	glfwGetWindowSize(glfw_window, &window_width, &window_height);
-	update_mouse_position(cse::Float2(static_cast<float>(mx), static_cast<float>(my)));
+	{
+		const Float2 old_mouse_screen_pos = mouse_screen_pos;
+		const int old_window_width = window_width;
+		const int old_window_height = window_height;
+		double mx, my;
+		glfwGetCursorPos(glfw_window, &mx, &my);
+		glfwGetWindowSize(glfw_window, &window_width, &window_height);
+		update_mouse_position(cse::Float2(static_cast<float>(mx), static_cast<float>(my)));
+		// Hover highlights and drags follow the mouse, so any movement needs a redraw
+		if (mouse_screen_pos != old_mouse_screen_pos || window_width != old_window_width || window_height != old_window_height) {
+			request_redraw();
+		}
+	}
 
 	// Handle window events
 	glfwPollEvents();
@@ -305,13 +424,6 @@ void cse::EditorMainWindow::pre_draw()
 		subwindow->update_selection(view->get_const_selection());
 	}
 
-	// Mark all connected input sockets
-	for (NodeConnection& connection : main_graph->connections) {
-		if (auto connection_end = connection.end_socket.lock()) {
-			connection_end->input_connected_this_frame = true;
-		}
-	}
-
 	// Update toolbar button state
 	toolbar->set_button_enabled(cse::ToolbarButtonType::UNDO, undo_stack.undo_available());
 	toolbar->set_button_enabled(cse::ToolbarButtonType::REDO, undo_stack.redo_available());
@@ -322,14 +434,25 @@ void cse::EditorMainWindow::pre_draw()
 	}
 }
 
-void cse::EditorMainWindow::draw()
+void cse::EditorMainWindow::draw(const bool view_drawn_offscreen)
 {
 	NVGcontext* const nvg_ctx_pointer = nvg_context->context_ptr;
 
 	// Draw view
-	nvgSave(nvg_ctx_pointer);
-	view->draw(nvg_ctx_pointer);
-	nvgRestore(nvg_ctx_pointer);
+	if (view_drawn_offscreen) {
+		const float window_width_fl = static_cast<float>(window_width);
+		const float window_height_fl = static_cast<float>(window_height);
+		const NVGpaint view_paint = nvgImagePattern(nvg_ctx_pointer, 0.0f, 0.0f, window_width_fl, window_height_fl, 0.0f, view_framebuffer->get_image(), 1.0f);
+		nvgBeginPath(nvg_ctx_pointer);
+		nvgRect(nvg_ctx_pointer, 0.0f, 0.0f, window_width_fl, window_height_fl);
+		nvgFillPaint(nvg_ctx_pointer, view_paint);
+		nvgFill(nvg_ctx_pointer);
+	}
+	else {
+		nvgSave(nvg_ctx_pointer);
+		view->draw(nvg_ctx_pointer);
+		nvgRestore(nvg_ctx_pointer);
+	}
 
 	// Draw toolbar
 	if (toolbar != nullptr) {
@@ -356,6 +479,61 @@ void cse::EditorMainWindow::draw()
 	}
 }
 
+void cse::EditorMainWindow::update_view_resolution_scale()
+{
+	if (view->is_interaction_active() == false || interaction_resolution_scale >= 1.0f || view_framebuffer_unsupported) {
+		view_resolution_scale = 1.0f;
+		return;
+	}
+	// Once reduced, stay reduced until the interaction ends so the resolution does not flicker back and forth
+	if (view_resolution_scale < 1.0f || last_frame_time > interaction_frame_time_threshold) {
+		view_resolution_scale = interaction_resolution_scale;
+	}
+}
+
+bool cse::EditorMainWindow::draw_view_offscreen(const int fb_width, const int fb_height, const float px_ratio)
+{
+	if (view_resolution_scale >= 1.0f) {
+		// Release the framebuffer's memory while it is not needed
+		view_framebuffer.reset();
+		return false;
+	}
+
+	const int target_width = std::max(1, static_cast<int>(std::ceil(fb_width * view_resolution_scale)));
+	const int target_height = std::max(1, static_cast<int>(std::ceil(fb_height * view_resolution_scale)));
+	if (view_framebuffer == nullptr || view_framebuffer->width != target_width || view_framebuffer->height != target_height) {
+		view_framebuffer = std::make_unique<NvgFramebuffer>(nvg_context->context_ptr, target_width, target_height, 0);
+		if (view_framebuffer->is_valid() == false) {
+			view_framebuffer.reset();
+			view_framebuffer_unsupported = true;
+			view_resolution_scale = 1.0f;
+			return false;
+		}
+	}
+
+	view_framebuffer->bind();
+
+	// The view image covers the whole window, so the background must be opaque
+	GLfloat clear_color[4];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, clear_color);
+	glClearColor(clear_color[0], clear_color[1], clear_color[2], 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+	glClearColor(clear_color[0], clear_color[1], clear_color[2], clear_color[3]);
+
+	NVGcontext* const nvg_ctx_pointer = nvg_context->context_ptr;
+	nvgBeginFrame(nvg_ctx_pointer, static_cast<float>(window_width), static_cast<float>(window_height), px_ratio * view_resolution_scale);
+	view->draw(nvg_ctx_pointer);
+	nvgEndFrame(nvg_ctx_pointer);
+
+	NvgFramebuffer::unbind();
+	return true;
+}
+
+bool cse::EditorMainWindow::should_draw_window()
+{
+	return glfwGetWindowAttrib(glfw_window, GLFW_ICONIFIED) == 0 && glfwGetWindowAttrib(glfw_window, GLFW_FOCUSED) != 0;
+}
+
 void cse::EditorMainWindow::swap_buffers()
 {
 	if (target_frame_rate > 0.0) {
@@ -373,6 +551,8 @@ void cse::EditorMainWindow::swap_buffers()
 	}
 	last_buffer_swap_time = std::chrono::steady_clock::now();
 	glfwSwapBuffers(glfw_window);
+	const std::chrono::duration<double> swap_duration = std::chrono::steady_clock::now() - last_buffer_swap_time;
+	last_swap_time = swap_duration.count();
 }
 
 void cse::EditorMainWindow::service_requests()
@@ -448,6 +628,7 @@ void cse::EditorMainWindow::push_undo_state()
 	undo_stack.push_undo_state(serialized_state);
 	update_serialized_state();
 	status_bar->set_status_text("Graph contains unsaved changes");
+	request_redraw();
 }
 
 void cse::EditorMainWindow::undo()
@@ -516,6 +697,7 @@ void cse::EditorMainWindow::release_resources()
 	toolbar.reset();
 	status_bar.reset();
 	view.reset();
+	view_framebuffer.reset();
 
 	glfw_window.release();
 	nvg_context.release();
@@ -20,6 +20,7 @@ namespace cse {
 	class NodeEditorSubwindow;
 	class NodeEditorToolbar;
 	class NvgContext;
+	class NvgFramebuffer;
 
 	class EditorMainWindow {
 	public:
@@ -27,12 +28,29 @@ namespace cse {
 		~EditorMainWindow();
 
 		void set_font_search_path(const PathString& font_path);
+		// If set, the prewarmed font atlas is stored in this file and loaded from it on later launches
+		void set_font_atlas_cache_path(const PathString& cache_path);
 
 		bool create_window();
 		bool run_window_loop_iteration();
 
 		void set_target_frame_rate(double fps);
 
+		// When enabled, the window is only drawn after input or a redraw request and the loop blocks waiting for events otherwise
+		void set_event_driven_redraw(bool enabled);
+		// Longest time in seconds that a loop iteration will wait for events before returning
+		void set_event_wait_timeout(double seconds);
+		// Marks the window as needing to be drawn on the next loop iteration
+		void request_redraw();
+		// Number of loop iterations that did not draw because nothing changed or the window could not be seen
+		unsigned long long get_skipped_frame_count() const;
+		// Graph view and GL submission counts from the last frame drawn, intended for profiling
+		std::string get_draw_stats() const;
+
+		// While panning or dragging, if frames take longer than the given time the view is drawn at the given scale of full resolution
+		// Full resolution is restored as soon as the interaction ends, a scale of 1.0 disables this
+		void set_dynamic_resolution(float interaction_scale, double frame_time_threshold_ms);
+
 		void handle_mouse_button(int button, int action, int mods);
 		void handle_key(int key, int scancode, int action, int mods);
 		void handle_character(unsigned int codepoint);
@@ -43,8 +61,19 @@ namespace cse {
 		bool get_serialized_output(std::string& graph);
 
 	private:
+		// Fills the font atlas before the first frame, from the cache file if possible
+		void prepare_font_atlas(const PathString& font_path);
+
 		void pre_draw();
-		void draw();
+		void draw(bool view_drawn_offscreen);
+
+		void update_view_resolution_scale();
+		// Draws the view to view_framebuffer if the view is being drawn at reduced resolution
+		// Returns false if the view should be drawn directly to the window instead
+		bool draw_view_offscreen(int fb_width, int fb_height, float px_ratio);
+
+		// False while the window is minimized or unfocused
+		bool should_draw_window();
 
 		void swap_buffers();
 
@@ -95,9 +124,28 @@ namespace cse {
 		bool serialized_output_updated = false;
 
 		double target_frame_rate = 60.0;
+
+		bool event_driven_redraw = true;
+		double event_wait_timeout = 0.25;
+		bool redraw_requested = true;
+		unsigned long long skipped_frame_count = 0;
+
+		// Dynamic resolution
+		float interaction_resolution_scale = 0.5f;
+		double interaction_frame_time_threshold = 1.0 / 60.0;
+		float view_resolution_scale = 1.0f;
+		// Time spent drawing and presenting the last frame, excluding any frame rate limiting
+		double last_frame_time = 0.0;
+		double last_swap_time = 0.0;
+		std::unique_ptr<NvgFramebuffer> view_framebuffer;
+		// Set if a framebuffer could not be created, the view is then always drawn at full resolution
+		bool view_framebuffer_unsupported = false;
 		std::chrono::time_point<std::chrono::steady_clock> last_buffer_swap_time;
+		// GL submission counts from the last drawn frame, returned by get_draw_stats
+		std::string draw_stats_text;
 
 		PathString font_search_path;
+		PathString font_atlas_cache_path;
 	};
 
 }
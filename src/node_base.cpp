@@ -1,16 +1,24 @@
 #include "node_base.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "config.h"
 #include "curve.h"
 #include "drawing.h"
 #include "gui_colors.h"
 #include "gui_sizes.h"
+#include "node_body_shapes.h"
+#include "node_registry.h"
 #include "sockets.h"
 #include "util_color_ramp.h"
 #include "util_enum.h"
+#include "util_hash.h"
 #include "util_vector.h"
 
 static cse::Float3 get_color_for_category(const cse::NodeCategory category)
@@ -37,6 +45,62 @@ static cse::Float3 get_color_for_category(const cse::NodeCategory category)
 	}
 }
 
+// Ordering used by the socket name indices, sockets are sorted by io type then name
+static bool socket_key_less(const cse::SocketIOType lhs_io_type, const std::string& lhs_name, const cse::SocketIOType rhs_io_type, const std::string& rhs_name)
+{
+	if (lhs_io_type != rhs_io_type) {
+		return static_cast<int>(lhs_io_type) < static_cast<int>(rhs_io_type);
+	}
+	return lhs_name < rhs_name;
+}
+
+static std::vector<std::size_t> create_socket_name_index(const std::vector<cse::SocketDefinition>& sockets, std::string cse::SocketDefinition::* const name_member)
+{
+	std::vector<std::size_t> result;
+	for (std::size_t i = 0; i < sockets.size(); i++) {
+		result.push_back(i);
+	}
+
+	// Stable so that when two sockets share a name the first one added is found, matching a linear search
+	std::stable_sort(
+		result.begin(),
+		result.end(),
+		[&sockets, name_member](const std::size_t lhs, const std::size_t rhs) {
+			return socket_key_less(sockets[lhs].io_type, sockets[lhs].*name_member, sockets[rhs].io_type, sockets[rhs].*name_member);
+		}
+	);
+
+	return result;
+}
+
+static std::size_t find_socket_in_index(
+	const std::vector<cse::SocketDefinition>& sockets,
+	const std::vector<std::size_t>& index,
+	std::string cse::SocketDefinition::* const name_member,
+	const cse::SocketIOType io_type,
+	const std::string& name)
+{
+	const auto iter = std::lower_bound(
+		index.begin(),
+		index.end(),
+		io_type,
+		[&sockets, name_member, &name](const std::size_t slot, const cse::SocketIOType key_io_type) {
+			return socket_key_less(sockets[slot].io_type, sockets[slot].*name_member, key_io_type, name);
+		}
+	);
+
+	if (iter == index.end()) {
+		return sockets.size();
+	}
+
+	const cse::SocketDefinition& found = sockets[*iter];
+	if (found.io_type != io_type || found.*name_member != name) {
+		return sockets.size();
+	}
+
+	return *iter;
+}
+
 cse::NodeConnection::NodeConnection(const std::weak_ptr<NodeSocket> begin_socket, const std::weak_ptr<NodeSocket> end_socket) :
 	begin_socket(begin_socket),
 	end_socket(end_socket)
@@ -64,12 +128,45 @@ bool cse::NodeConnection::includes_node(EditableNode* const node) const
 	return false;
 }
 
-cse::EditableNode::EditableNode(NodeCategory category, CyclesNodeType type, const std::string& title) :
-	category(category),
+cse::NodeSchema::NodeSchema(const CyclesNodeType type) :
+	category(get_node_type_info(type)->category),
 	type(type),
-	title(title)
+	title(get_node_type_info(type)->title)
+{
+
+}
+
+cse::NodeSchema cse::NodeSchema::with_socket_index(NodeSchema schema)
 {
+	schema.sockets_by_display_name = create_socket_name_index(schema.sockets, &SocketDefinition::display_name);
+	schema.sockets_by_internal_name = create_socket_name_index(schema.sockets, &SocketDefinition::internal_name);
+	return schema;
+}
 
+std::size_t cse::NodeSchema::find_socket_by_display_name(const SocketIOType io_type, const std::string& name) const
+{
+	return find_socket_in_index(sockets, sockets_by_display_name, &SocketDefinition::display_name, io_type, name);
+}
+
+std::size_t cse::NodeSchema::find_socket_by_internal_name(const SocketIOType io_type, const std::string& name) const
+{
+	return find_socket_in_index(sockets, sockets_by_internal_name, &SocketDefinition::internal_name, io_type, name);
+}
+
+cse::EditableNode::EditableNode(const NodeSchema& schema, const Float2 position) :
+	world_pos(position),
+	schema(schema),
+	category(schema.category),
+	type(schema.type),
+	title(schema.title),
+	content_width(schema.content_width)
+{
+	sockets.reserve(schema.sockets.size());
+	for (const SocketDefinition& this_definition : schema.sockets) {
+		sockets.push_back(std::make_shared<NodeSocket>(this, this_definition));
+	}
+
+	update_layout();
 }
 
 std::string cse::EditableNode::get_title() const
@@ -77,24 +174,34 @@ std::string cse::EditableNode::get_title() const
 	return title;
 }
 
-void cse::EditableNode::draw_node(NVGcontext* const draw_context, const bool selected, const std::shared_ptr<cse::NodeSocket> selected_socket)
+void cse::EditableNode::draw_node(
+	NVGcontext* const draw_context,
+	NodeBodyShapes& body_shapes,
+	const bool selected,
+	const std::shared_ptr<cse::NodeSocket> selected_socket
+	)
 {
 	const Float3 header_color = get_color_for_category(category);
 
-	content_height = Drawing::draw_node(
+	Drawing::draw_node(
 		draw_context,
+		body_shapes,
 		title.c_str(),
 		header_color,
 		content_width,
-		world_pos,
+		content_height,
 		selected,
 		sockets,
-		selected_socket,
-		socket_targets,
-		label_targets
+		selected_socket
 	);
 }
 
+void cse::EditableNode::draw_node_simple(NVGcontext* const draw_context, NodeBodyShapes& body_shapes, const bool selected)
+{
+	const Float3 header_color = get_color_for_category(category);
+	body_shapes.draw_body_simple(draw_context, content_width, content_height, header_color, selected);
+}
+
 bool cse::EditableNode::contains_point(const Float2 world_pos_in) const
 {
 	const Float2 local_pos = get_local_pos(world_pos_in);
@@ -134,20 +241,19 @@ std::weak_ptr<cse::NodeSocket> cse::EditableNode::get_socket_label_under_point(c
 
 std::weak_ptr<cse::NodeSocket> cse::EditableNode::get_socket_by_display_name(const SocketIOType in_out, const std::string& socket_name)
 {
-	for (const auto socket : sockets) {
-		if (socket->display_name == socket_name && socket->io_type == in_out) {
-			return socket;
-		}
+	// Sockets are created in schema order so the schema's index can be used directly
+	const std::size_t index = schema.find_socket_by_display_name(in_out, socket_name);
+	if (index < sockets.size()) {
+		return sockets[index];
 	}
 	return std::weak_ptr<NodeSocket>();
 }
 
 std::weak_ptr<cse::NodeSocket> cse::EditableNode::get_socket_by_internal_name(const SocketIOType in_out, const std::string& socket_name)
 {
-	for (const auto socket : sockets) {
-		if (socket->internal_name == socket_name && socket->io_type == in_out) {
-			return socket;
-		}
+	const std::size_t index = schema.find_socket_by_internal_name(in_out, socket_name);
+	if (index < sockets.size()) {
+		return sockets[index];
 	}
 	return std::weak_ptr<NodeSocket>();
 }
@@ -157,6 +263,52 @@ cse::Float2 cse::EditableNode::get_dimensions()
 	return cse::Float2(content_width, content_height + UI_NODE_HEADER_HEIGHT);
 }
 
+std::uint64_t cse::EditableNode::get_appearance_hash(const bool selected, const std::shared_ptr<NodeSocket>& selected_socket) const
+{
+	std::uint64_t hash = HASH_SEED;
+	hash_value(hash, selected);
+	for (const auto& this_socket : sockets) {
+		// Only values that appear in the socket's label are included here
+		hash_value(hash, this_socket == selected_socket);
+		hash_value(hash, this_socket->is_connected());
+		if (this_socket->value.use_count() == 0) {
+			continue;
+		}
+		if (this_socket->socket_type == SocketType::FLOAT) {
+			if (const auto float_val = std::dynamic_pointer_cast<FloatSocketValue>(this_socket->value)) {
+				hash_value(hash, float_val->get_value());
+			}
+		}
+		else if (this_socket->socket_type == SocketType::INT) {
+			if (const auto int_val = std::dynamic_pointer_cast<IntSocketValue>(this_socket->value)) {
+				hash_value(hash, int_val->get_value());
+			}
+		}
+		else if (this_socket->socket_type == SocketType::BOOLEAN) {
+			if (const auto bool_val = std::dynamic_pointer_cast<BoolSocketValue>(this_socket->value)) {
+				hash_value(hash, bool_val->value);
+			}
+		}
+		else if (this_socket->socket_type == SocketType::COLOR) {
+			if (const auto color_val = std::dynamic_pointer_cast<ColorSocketValue>(this_socket->value)) {
+				const Float3 color = color_val->get_value();
+				hash_value(hash, color.x);
+				hash_value(hash, color.y);
+				hash_value(hash, color.z);
+			}
+		}
+	}
+	return hash;
+}
+
+cse::Area cse::EditableNode::get_world_bounds() const
+{
+	const float margin = UI_NODE_SOCKET_RADIUS + 1.0f;
+	const Float2 begin = world_pos - Float2(margin, margin);
+	const Float2 end = world_pos + Float2(content_width + margin, UI_NODE_HEADER_HEIGHT + content_height + margin);
+	return Area(begin, end);
+}
+
 bool cse::EditableNode::can_be_deleted()
 {
 	return true;
@@ -224,16 +376,14 @@ void cse::EditableNode::update_output_node(OutputNode& output)
 			if (curve_val) {
 				OutputCurve out_curve;
 				typedef std::vector<Float2>::size_type vec_index;
-				for (vec_index i = 0; i < curve_val->curve_points.size(); i++) {
-					const Float2 this_point = curve_val->curve_points[i];
+				for (vec_index i = 0; i < curve_val->get_curve_points().size(); i++) {
+					const Float2 this_point = curve_val->get_curve_points()[i];
 					out_curve.control_points.push_back(Float2(this_point.x, this_point.y));
 				}
-				out_curve.enum_curve_interp = static_cast<int>(curve_val->curve_interp);
-				const CurveEvaluator curve(curve_val);
-				for (vec_index i = 0; i < CURVE_TABLE_SIZE; i++) {
-					const float x = static_cast<float>(i) / (CURVE_TABLE_SIZE - 1.0f);
-					out_curve.samples.push_back(curve.eval(x));
-				}
+				out_curve.enum_curve_interp = static_cast<int>(curve_val->get_curve_interp());
+				// The evaluator's table lines up exactly with the output table
+				const CurveEvaluator curve(curve_val, CURVE_TABLE_SIZE - 1);
+				out_curve.samples = curve.get_samples();
 				output.curve_values[this_socket->internal_name] = out_curve;
 			}
 		}
@@ -243,7 +393,7 @@ void cse::EditableNode::update_output_node(OutputNode& output)
 				OutputColorRamp out_ramp;
 
 				// Copy over control points
-				for (const auto& this_point : ramp_val->ramp_points) {
+				for (const auto& this_point : ramp_val->get_ramp_points()) {
 					OutputColorRampPoint new_point;
 					new_point.pos = this_point.position;
 					new_point.color = this_point.color;
@@ -252,7 +402,7 @@ void cse::EditableNode::update_output_node(OutputNode& output)
 				}
 
 				// Copy evaluated samples
-				std::vector<Float4> samples = ramp_val->evaluate_samples();
+				const std::vector<Float4>& samples = ramp_val->get_samples();
 				for (const auto& this_sample : samples) {
 					out_ramp.samples_color.push_back(Float3(this_sample.x, this_sample.y, this_sample.z));
 					out_ramp.samples_alpha.push_back(this_sample.w);
@@ -268,3 +418,32 @@ cse::Float2 cse::EditableNode::get_local_pos(const Float2 world_pos_in) const
 {
 	return world_pos_in - world_pos;
 }
+
+void cse::EditableNode::update_layout()
+{
+	socket_targets.clear();
+	label_targets.clear();
+
+	content_height = sockets.size() * UI_NODE_SOCKET_ROW_HEIGHT + UI_NODE_BOTTOM_PADDING;
+
+	// Each socket gets one row below the header
+	float next_row_y = UI_NODE_HEADER_HEIGHT + 2.0f;
+	for (const auto& this_socket : sockets) {
+		const float socket_x = (this_socket->io_type == SocketIOType::INPUT) ? 0.0f : content_width;
+		this_socket->local_position = Float2(socket_x, next_row_y + UI_NODE_SOCKET_ROW_HEIGHT / 2);
+
+		if (this_socket->selectable) {
+			const Float2 click_target_begin(0.0f, next_row_y);
+			const Float2 click_target_end(content_width, next_row_y + UI_NODE_SOCKET_ROW_HEIGHT);
+			label_targets.push_back(HolderArea<std::weak_ptr<NodeSocket>>(click_target_begin, click_target_end, this_socket));
+		}
+
+		if (this_socket->draw_socket) {
+			const Float2 click_target_begin = this_socket->local_position - Float2(7.0f, 7.0f);
+			const Float2 click_target_end = this_socket->local_position + Float2(7.0f, 7.0f);
+			socket_targets.push_back(HolderArea<std::weak_ptr<NodeSocket>>(click_target_begin, click_target_end, this_socket));
+		}
+
+		next_row_y += UI_NODE_SOCKET_ROW_HEIGHT;
+	}
+}
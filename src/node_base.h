@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "output.h"
+#include "sockets.h"
 #include "util_area.h"
 #include "util_enum.h"
 #include "util_vector.h"
@@ -13,9 +16,46 @@ struct NVGcontext;
 
 namespace cse {
 
+	class NodeBodyShapes;
 	class NodeSocket;
 	class EditableNode;
 
+	// Immutable description of a node type
+	// A single instance is shared by every node of the type, nodes only hold their mutable socket values
+	class NodeSchema {
+	public:
+		// Category and title are taken from the node type registry
+		explicit NodeSchema(CyclesNodeType type);
+
+		// Returns a copy of the input with the socket name indices built, this must be called after all sockets are added
+		static NodeSchema with_socket_index(NodeSchema schema);
+
+		// Both of these return the position of the matching socket in sockets, or sockets.size() if there is no match
+		std::size_t find_socket_by_display_name(SocketIOType io_type, const std::string& name) const;
+		std::size_t find_socket_by_internal_name(SocketIOType io_type, const std::string& name) const;
+
+		NodeCategory category;
+		CyclesNodeType type;
+		std::string title;
+
+		float content_width = 150.0f;
+
+		std::vector<SocketDefinition> sockets;
+
+	private:
+		// Positions in sockets, sorted by io type then name so lookups can use a binary search
+		std::vector<std::size_t> sockets_by_display_name;
+		std::vector<std::size_t> sockets_by_internal_name;
+	};
+
+	// Returns the schema created by CreateSchema, the schema is created only once on first use
+	template<NodeSchema (*CreateSchema)()>
+	const NodeSchema& get_static_schema()
+	{
+		static const NodeSchema schema = NodeSchema::with_socket_index(CreateSchema());
+		return schema;
+	}
+
 	class NodeConnection {
 	public:
 		NodeConnection(std::weak_ptr<NodeSocket> begin_socket, std::weak_ptr<NodeSocket> end_socket);
@@ -29,12 +69,14 @@ namespace cse {
 
 	class EditableNode {
 	public:
-		EditableNode(NodeCategory category, CyclesNodeType type, const std::string& title);
+		EditableNode(const NodeSchema& schema, Float2 position);
 		virtual ~EditableNode() {}
 
 		virtual std::string get_title() const;
 
-		virtual void draw_node(NVGcontext* draw_context, bool selected, std::shared_ptr<NodeSocket> selected_socket);
+		virtual void draw_node(NVGcontext* draw_context, NodeBodyShapes& body_shapes, bool selected, std::shared_ptr<NodeSocket> selected_socket);
+		// Draws the node with no text or sockets
+		void draw_node_simple(NVGcontext* draw_context, NodeBodyShapes& body_shapes, bool selected);
 
 		virtual bool contains_point(Float2 world_pos_in) const;
 		virtual std::weak_ptr<NodeSocket> get_socket_connector_under_point(Float2 check_world_pos) const;
@@ -44,6 +86,11 @@ namespace cse {
 		virtual std::weak_ptr<NodeSocket> get_socket_by_internal_name(SocketIOType in_out, const std::string& socket_name);
 
 		virtual Float2 get_dimensions();
+		// Hash of everything that affects how draw_node draws this node
+		// Two calls returning the same value will draw identical images
+		std::uint64_t get_appearance_hash(bool selected, const std::shared_ptr<NodeSocket>& selected_socket) const;
+		// Area covering everything drawn for this node, including the sockets that extend past its edges
+		Area get_world_bounds() const;
 
 		virtual bool can_be_deleted();
 
@@ -51,17 +98,26 @@ namespace cse {
 
 		bool changed = true;
 
+		// Maintained by Selection, true while this node is part of the view's selection
+		bool selected = false;
+
 		Float2 world_pos;
 
 	protected:
 		Float2 get_local_pos(Float2 world_pos_in) const;
 
+		// Calculates the node's height, socket positions, and click targets
+		// Everything here is relative to world_pos so this only needs to run again if the node's width or sockets change
+		void update_layout();
+
+		const NodeSchema& schema;
+
 		const NodeCategory category;
 		const CyclesNodeType type;
 
-		const std::string title;
+		const std::string& title;
 
-		float content_width = 150.0f;
+		float content_width;
 		float content_height = 0.0f;
 
 		std::vector<std::shared_ptr<NodeSocket>> sockets;
@@ -0,0 +1,184 @@
+#include "node_body_shapes.h"
+
+#include <nanovg.h>
+
+#include "gui_sizes.h"
+#include "util_hash.h"
+#include "util_vector.h"
+#include "wrapper_nvg_func.h"
+#include "wrapper_nvg_shape.h"
+
+using AddPathFunc = void (*)(NVGcontext*, float, float);
+
+static void add_body_path(NVGcontext* const draw_context, const float node_width, const float node_height)
+{
+	nvgRoundedRect(draw_context, 0.0f, 0.0f, node_width, node_height + UI_NODE_HEADER_HEIGHT, UI_NODE_CORNER_RADIUS);
+}
+
+static void add_header_path(NVGcontext* const draw_context, const float node_width, float)
+{
+	// Only the top corners are rounded, the rect squares off the bottom ones
+	nvgRoundedRect(draw_context, 0.0f, 0.0f, node_width, UI_NODE_HEADER_HEIGHT, UI_NODE_CORNER_RADIUS);
+	nvgRect(draw_context, 0.0f, UI_NODE_HEADER_HEIGHT - UI_NODE_CORNER_RADIUS, node_width, UI_NODE_CORNER_RADIUS);
+}
+
+static void add_header_line_path(NVGcontext* const draw_context, const float node_width, float)
+{
+	nvgMoveTo(draw_context, 0.0f, UI_NODE_HEADER_HEIGHT);
+	nvgLineTo(draw_context, node_width, UI_NODE_HEADER_HEIGHT);
+}
+
+static void add_simple_body_path(NVGcontext* const draw_context, const float node_width, const float node_height)
+{
+	nvgRect(draw_context, 0.0f, 0.0f, node_width, node_height + UI_NODE_HEADER_HEIGHT);
+}
+
+static void add_simple_header_path(NVGcontext* const draw_context, const float node_width, float)
+{
+	nvgRect(draw_context, 0.0f, 0.0f, node_width, UI_NODE_HEADER_HEIGHT);
+}
+
+// Draws the shape with the current paint, tessellating it from its path first if it can not be drawn as it is
+// Returns true if the shape was tessellated
+static bool draw_shape(
+	NVGcontext* const draw_context,
+	cse::NvgShape& shape,
+	const bool stroke,
+	const AddPathFunc add_path,
+	const float node_width,
+	const float node_height
+	)
+{
+	if (nvgDrawShape(draw_context, shape.shape_ptr)) {
+		return false;
+	}
+
+	nvgBeginPath(draw_context);
+	add_path(draw_context, node_width, node_height);
+	if (stroke) {
+		nvgStrokeToShape(draw_context, shape.shape_ptr);
+	}
+	else {
+		nvgFillToShape(draw_context, shape.shape_ptr);
+	}
+
+	if (nvgDrawShape(draw_context, shape.shape_ptr) == 0) {
+		// The shape could not be allocated, draw the path directly
+		if (stroke) {
+			nvgStroke(draw_context);
+		}
+		else {
+			nvgFill(draw_context);
+		}
+	}
+	return true;
+}
+
+cse::NodeBodyShapes::BodyShapeSet::BodyShapeSet() :
+	body(std::make_unique<NvgShape>()),
+	header(std::make_unique<NvgShape>()),
+	header_line(std::make_unique<NvgShape>()),
+	border(std::make_unique<NvgShape>())
+{
+
+}
+
+cse::NodeBodyShapes::BodyShapeSet::~BodyShapeSet()
+{
+	// Empty destructor is needed so incomplete NvgShape type can be used in the header
+}
+
+cse::NodeBodyShapes::NodeBodyShapes()
+{
+
+}
+
+cse::NodeBodyShapes::~NodeBodyShapes()
+{
+
+}
+
+void cse::NodeBodyShapes::draw_body(
+	NVGcontext* const draw_context,
+	const float node_width,
+	const float node_height,
+	const Float3 header_color,
+	const bool selected
+	)
+{
+	BodyShapeSet& shapes = get_shape_set(false, node_width, node_height);
+
+	nvgFillColor(draw_context, nvgRGBA(180, 180, 180, 255));
+	tessellated_count += draw_shape(draw_context, *shapes.body, false, add_body_path, node_width, node_height);
+
+	nvgFillColor(draw_context, header_color);
+	tessellated_count += draw_shape(draw_context, *shapes.header, false, add_header_path, node_width, node_height);
+
+	nvgStrokeColor(draw_context, nvgRGBA(0, 0, 0, 225));
+	nvgStrokeWidth(draw_context, 1.3f);
+	tessellated_count += draw_shape(draw_context, *shapes.header_line, true, add_header_line_path, node_width, node_height);
+
+	if (selected) {
+		nvgStrokeColor(draw_context, nvgRGBA(255, 255, 255, 225));
+	}
+	else {
+		nvgStrokeColor(draw_context, nvgRGBA(0, 0, 0, 225));
+	}
+	nvgStrokeWidth(draw_context, 1.5f);
+	tessellated_count += draw_shape(draw_context, *shapes.border, true, add_body_path, node_width, node_height);
+}
+
+void cse::NodeBodyShapes::draw_body_simple(
+	NVGcontext* const draw_context,
+	const float node_width,
+	const float node_height,
+	const Float3 header_color,
+	const bool selected
+	)
+{
+	BodyShapeSet& shapes = get_shape_set(true, node_width, node_height);
+
+	nvgFillColor(draw_context, nvgRGBA(180, 180, 180, 255));
+	tessellated_count += draw_shape(draw_context, *shapes.body, false, add_simple_body_path, node_width, node_height);
+
+	nvgFillColor(draw_context, header_color);
+	tessellated_count += draw_shape(draw_context, *shapes.header, false, add_simple_header_path, node_width, node_height);
+
+	// Only selected nodes get a border, so the selection stays visible
+	if (selected) {
+		nvgStrokeColor(draw_context, nvgRGBA(255, 255, 255, 225));
+		nvgStrokeWidth(draw_context, 3.0f);
+		tessellated_count += draw_shape(draw_context, *shapes.border, true, add_simple_body_path, node_width, node_height);
+	}
+}
+
+void cse::NodeBodyShapes::remove_unused()
+{
+	for (auto iter = shape_sets.begin(); iter != shape_sets.end(); ) {
+		if (iter->second.used) {
+			iter->second.used = false;
+			++iter;
+		}
+		else {
+			iter = shape_sets.erase(iter);
+		}
+	}
+	tessellated_count = 0;
+}
+
+unsigned int cse::NodeBodyShapes::get_tessellated_count() const
+{
+	return tessellated_count;
+}
+
+cse::NodeBodyShapes::BodyShapeSet& cse::NodeBodyShapes::get_shape_set(const bool simple, const float node_width, const float node_height)
+{
+	std::uint64_t key = HASH_SEED;
+	hash_value(key, simple);
+	hash_value(key, node_width);
+	hash_value(key, node_height);
+
+	BodyShapeSet& result = shape_sets[key];
+	result.used = true;
+	return result;
+}
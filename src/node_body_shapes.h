@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+
+struct NVGcontext;
+
+namespace cse {
+
+	class Float3;
+	class NvgShape;
+
+	// Draws node bodies, the rounded box, header, and border behind a node's title and sockets
+	// Each distinct body size is tessellated once and drawn for every node of that size with that node's header color and selection state
+	class NodeBodyShapes {
+	public:
+		NodeBodyShapes();
+		~NodeBodyShapes();
+
+		// Both of these draw with the body's top left corner at the current origin
+		void draw_body(NVGcontext* draw_context, float node_width, float node_height, Float3 header_color, bool selected);
+		// Body drawn as a header block and box only, for when the view is zoomed out too far for text to be readable
+		void draw_body_simple(NVGcontext* draw_context, float node_width, float node_height, Float3 header_color, bool selected);
+
+		// Deletes the shapes of every body size that was not drawn since the last call
+		void remove_unused();
+
+		// Number of body shapes tessellated since the last call to remove_unused
+		unsigned int get_tessellated_count() const;
+
+	private:
+		class BodyShapeSet {
+		public:
+			BodyShapeSet();
+			~BodyShapeSet();
+
+			std::unique_ptr<NvgShape> body;
+			std::unique_ptr<NvgShape> header;
+			std::unique_ptr<NvgShape> header_line;
+			std::unique_ptr<NvgShape> border;
+			bool used = false;
+		};
+
+		BodyShapeSet& get_shape_set(bool simple, float node_width, float node_height);
+
+		std::map<std::uint64_t, BodyShapeSet> shape_sets;
+		unsigned int tessellated_count = 0;
+	};
+
+}
@@ -12,180 +12,242 @@
 #include "util_enum.h"
 #include "util_vector.h"
 
-cse::MixRGBNode::MixRGBNode(const Float2 position) : EditableNode(NodeCategory::COLOR, CyclesNodeType::MixRGB, "Mix RGB")
+static cse::NodeSchema create_mix_rgb_schema()
 {
-	world_pos = position;
-
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
-
-	sockets.push_back(color_output);
-
-	const auto type_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Type", "type");
-	const auto type_value = std::make_shared<StringEnumSocketValue>();
-	type_value->enum_values.push_back(StringEnumPair("Linear Light", "linear_light"));
-	type_value->enum_values.push_back(StringEnumPair("Soft Light", "soft_light"));
-	type_value->enum_values.push_back(StringEnumPair("Color", "color"));
-	type_value->enum_values.push_back(StringEnumPair("Value", "value"));
-	type_value->enum_values.push_back(StringEnumPair("Saturation", "saturation"));
-	type_value->enum_values.push_back(StringEnumPair("Hue", "hue"));
-	type_value->enum_values.push_back(StringEnumPair("Burn", "burn"));
-	type_value->enum_values.push_back(StringEnumPair("Dodge", "dodge"));
-	type_value->enum_values.push_back(StringEnumPair("Overlay", "overlay"));
-	type_value->enum_values.push_back(StringEnumPair("Lighten", "lighten"));
-	type_value->enum_values.push_back(StringEnumPair("Darken", "darken"));
-	type_value->enum_values.push_back(StringEnumPair("Difference", "difference"));
-	type_value->enum_values.push_back(StringEnumPair("Divide", "divide"));
-	type_value->enum_values.push_back(StringEnumPair("Screen", "screen"));
-	type_value->enum_values.push_back(StringEnumPair("Subtract", "subtract"));
-	type_value->enum_values.push_back(StringEnumPair("Multiply", "multiply"));
-	type_value->enum_values.push_back(StringEnumPair("Add", "add"));
-	type_value->enum_values.push_back(StringEnumPair("Mix", "mix"));
-	type_value->set_from_internal_name("mix");
-	type_input->value = type_value;
-	const auto clamp_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::BOOLEAN, "Clamp", "use_clamp");
-	clamp_input->value = std::make_shared<BoolSocketValue>(false);
-	const auto fac_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
-	fac_input->value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
-	const auto color1_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color1", "color1");
-	color1_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto color2_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color2", "color2");
-	color2_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-
-	sockets.push_back(type_input);
-	sockets.push_back(clamp_input);
-	sockets.push_back(fac_input);
-	sockets.push_back(color1_input);
-	sockets.push_back(color2_input);
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::MixRGB);
+
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+
+	schema.sockets.push_back(color_output);
+
+	SocketDefinition type_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Type", "type");
+	std::vector<StringEnumPair> type_enum_values;
+	type_enum_values.push_back(StringEnumPair("Linear Light", "linear_light"));
+	type_enum_values.push_back(StringEnumPair("Soft Light", "soft_light"));
+	type_enum_values.push_back(StringEnumPair("Color", "color"));
+	type_enum_values.push_back(StringEnumPair("Value", "value"));
+	type_enum_values.push_back(StringEnumPair("Saturation", "saturation"));
+	type_enum_values.push_back(StringEnumPair("Hue", "hue"));
+	type_enum_values.push_back(StringEnumPair("Burn", "burn"));
+	type_enum_values.push_back(StringEnumPair("Dodge", "dodge"));
+	type_enum_values.push_back(StringEnumPair("Overlay", "overlay"));
+	type_enum_values.push_back(StringEnumPair("Lighten", "lighten"));
+	type_enum_values.push_back(StringEnumPair("Darken", "darken"));
+	type_enum_values.push_back(StringEnumPair("Difference", "difference"));
+	type_enum_values.push_back(StringEnumPair("Divide", "divide"));
+	type_enum_values.push_back(StringEnumPair("Screen", "screen"));
+	type_enum_values.push_back(StringEnumPair("Subtract", "subtract"));
+	type_enum_values.push_back(StringEnumPair("Multiply", "multiply"));
+	type_enum_values.push_back(StringEnumPair("Add", "add"));
+	type_enum_values.push_back(StringEnumPair("Mix", "mix"));
+	type_input.default_value = std::make_shared<StringEnumSocketValue>(type_enum_values, "mix");
+	SocketDefinition clamp_input(SocketIOType::INPUT, SocketType::BOOLEAN, "Clamp", "use_clamp");
+	clamp_input.default_value = std::make_shared<BoolSocketValue>(false);
+	SocketDefinition fac_input(SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
+	fac_input.default_value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
+	SocketDefinition color1_input(SocketIOType::INPUT, SocketType::COLOR, "Color1", "color1");
+	color1_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition color2_input(SocketIOType::INPUT, SocketType::COLOR, "Color2", "color2");
+	color2_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+
+	schema.sockets.push_back(type_input);
+	schema.sockets.push_back(clamp_input);
+	schema.sockets.push_back(fac_input);
+	schema.sockets.push_back(color1_input);
+	schema.sockets.push_back(color2_input);
+
+	return schema;
 }
 
-cse::InvertNode::InvertNode(const Float2 position) : EditableNode(NodeCategory::COLOR, CyclesNodeType::Invert, "Invert")
+cse::MixRGBNode::MixRGBNode(const Float2 position) : EditableNode(get_static_schema<create_mix_rgb_schema>(), position)
 {
-	world_pos = position;
 
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+}
+
+static cse::NodeSchema create_invert_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::Invert);
+
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+
+	schema.sockets.push_back(color_output);
 
-	sockets.push_back(color_output);
+	SocketDefinition fac_input(SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
+	fac_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
 
-	const auto fac_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
-	fac_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	schema.sockets.push_back(fac_input);
+	schema.sockets.push_back(color_input);
 
-	sockets.push_back(fac_input);
-	sockets.push_back(color_input);
+	return schema;
 }
 
-cse::LightFalloffNode::LightFalloffNode(const Float2 position) : EditableNode(NodeCategory::COLOR, CyclesNodeType::LightFalloff, "Light Falloff")
+cse::InvertNode::InvertNode(const Float2 position) : EditableNode(get_static_schema<create_invert_schema>(), position)
 {
-	world_pos = position;
 
-	const auto quadratic_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Quadratic", "quadratic");
-	const auto linear_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Linear", "linear");
-	const auto constant_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Constant", "constant");
+}
+
+static cse::NodeSchema create_light_falloff_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::LightFalloff);
+
+	SocketDefinition quadratic_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Quadratic", "quadratic");
+	SocketDefinition linear_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Linear", "linear");
+	SocketDefinition constant_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Constant", "constant");
 
-	sockets.push_back(quadratic_output);
-	sockets.push_back(linear_output);
-	sockets.push_back(constant_output);
+	schema.sockets.push_back(quadratic_output);
+	schema.sockets.push_back(linear_output);
+	schema.sockets.push_back(constant_output);
 
-	const auto strength_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Strength", "strength");
-	strength_input->value = std::make_shared<FloatSocketValue>(100.0f, 0.0f, 10000.0f);
-	const auto smooth_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Smooth", "smooth");
-	smooth_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1000.0f);
+	SocketDefinition strength_input(SocketIOType::INPUT, SocketType::FLOAT, "Strength", "strength");
+	strength_input.default_value = std::make_shared<FloatSocketValue>(100.0f, 0.0f, 10000.0f);
+	SocketDefinition smooth_input(SocketIOType::INPUT, SocketType::FLOAT, "Smooth", "smooth");
+	smooth_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1000.0f);
 
-	sockets.push_back(strength_input);
-	sockets.push_back(smooth_input);
+	schema.sockets.push_back(strength_input);
+	schema.sockets.push_back(smooth_input);
+
+	return schema;
 }
 
-cse::HSVNode::HSVNode(const Float2 position) : EditableNode(NodeCategory::COLOR, CyclesNodeType::HSV, "HSV")
+cse::LightFalloffNode::LightFalloffNode(const Float2 position) : EditableNode(get_static_schema<create_light_falloff_schema>(), position)
 {
-	world_pos = position;
-
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
-
-	sockets.push_back(color_output);
-
-	const auto hue_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Hue", "hue");
-	hue_input->value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
-	const auto sat_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Saturation", "saturation");
-	sat_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 2.0f);
-	const auto val_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Value", "value");
-	val_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 2.0f);
-	const auto fac_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
-	fac_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-
-	sockets.push_back(hue_input);
-	sockets.push_back(sat_input);
-	sockets.push_back(val_input);
-	sockets.push_back(fac_input);
-	sockets.push_back(color_input);
+
 }
 
-cse::GammaNode::GammaNode(const Float2 position) : EditableNode(NodeCategory::COLOR, CyclesNodeType::Gamma, "Gamma")
+static cse::NodeSchema create_hsv_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::HSV);
 
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
 
-	sockets.push_back(color_output);
+	schema.sockets.push_back(color_output);
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto gamma_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Gamma", "gamma");
-	gamma_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.001f, 10.0f);
+	SocketDefinition hue_input(SocketIOType::INPUT, SocketType::FLOAT, "Hue", "hue");
+	hue_input.default_value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
+	SocketDefinition sat_input(SocketIOType::INPUT, SocketType::FLOAT, "Saturation", "saturation");
+	sat_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 2.0f);
+	SocketDefinition val_input(SocketIOType::INPUT, SocketType::FLOAT, "Value", "value");
+	val_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 2.0f);
+	SocketDefinition fac_input(SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
+	fac_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
 
-	sockets.push_back(color_input);
-	sockets.push_back(gamma_input);
+	schema.sockets.push_back(hue_input);
+	schema.sockets.push_back(sat_input);
+	schema.sockets.push_back(val_input);
+	schema.sockets.push_back(fac_input);
+	schema.sockets.push_back(color_input);
+
+	return schema;
 }
 
-cse::BrightnessContrastNode::BrightnessContrastNode(const Float2 position) : EditableNode(NodeCategory::COLOR, CyclesNodeType::BrightnessContrast, "Bright/Contrast")
+cse::HSVNode::HSVNode(const Float2 position) : EditableNode(get_static_schema<create_hsv_schema>(), position)
 {
-	world_pos = position;
 
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+}
 
-	sockets.push_back(color_output);
+static cse::NodeSchema create_gamma_schema()
+{
+	using namespace cse;
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto bright_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Bright", "bright");
-	bright_input->value = std::make_shared<FloatSocketValue>(0.0f, -100.0f, 100.0f);
-	const auto cont_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Contrast", "contrast");
-	cont_input->value = std::make_shared<FloatSocketValue>(0.0f, -100.0f, 100.0f);
+	NodeSchema schema(CyclesNodeType::Gamma);
 
-	sockets.push_back(color_input);
-	sockets.push_back(bright_input);
-	sockets.push_back(cont_input);
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+
+	schema.sockets.push_back(color_output);
+
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition gamma_input(SocketIOType::INPUT, SocketType::FLOAT, "Gamma", "gamma");
+	gamma_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.001f, 10.0f);
+
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(gamma_input);
+
+	return schema;
 }
 
-cse::RGBCurvesNode::RGBCurvesNode(const Float2 position) : EditableNode(NodeCategory::COLOR, CyclesNodeType::RGBCurves, "RGB Curves")
+cse::GammaNode::GammaNode(const Float2 position) : EditableNode(get_static_schema<create_gamma_schema>(), position)
 {
-	world_pos = position;
-
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
-
-	sockets.push_back(color_output);
-
-	const auto rgb_curve_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CURVE, "RGB Curve", "rgb_curve");
-	rgb_curve_input->value = std::make_shared<CurveSocketValue>();
-	const auto r_curve_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CURVE, "Red Curve", "r_curve");
-	r_curve_input->value = std::make_shared<CurveSocketValue>();
-	const auto g_curve_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CURVE, "Green Curve", "g_curve");
-	g_curve_input->value = std::make_shared<CurveSocketValue>();
-	const auto b_curve_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CURVE, "Blue Curve", "b_curve");
-	b_curve_input->value = std::make_shared<CurveSocketValue>();
-	const auto fac_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
-	fac_input->value = std::make_shared<FloatSocketValue>(1.0f, -1.0f, 1.0f);
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-
-	sockets.push_back(rgb_curve_input);
-	sockets.push_back(r_curve_input);
-	sockets.push_back(g_curve_input);
-	sockets.push_back(b_curve_input);
-	sockets.push_back(fac_input);
-	sockets.push_back(color_input);
+
+}
+
+static cse::NodeSchema create_brightness_contrast_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::BrightnessContrast);
+
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+
+	schema.sockets.push_back(color_output);
+
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition bright_input(SocketIOType::INPUT, SocketType::FLOAT, "Bright", "bright");
+	bright_input.default_value = std::make_shared<FloatSocketValue>(0.0f, -100.0f, 100.0f);
+	SocketDefinition cont_input(SocketIOType::INPUT, SocketType::FLOAT, "Contrast", "contrast");
+	cont_input.default_value = std::make_shared<FloatSocketValue>(0.0f, -100.0f, 100.0f);
+
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(bright_input);
+	schema.sockets.push_back(cont_input);
+
+	return schema;
+}
+
+cse::BrightnessContrastNode::BrightnessContrastNode(const Float2 position) : EditableNode(get_static_schema<create_brightness_contrast_schema>(), position)
+{
+
+}
+
+static cse::NodeSchema create_rgb_curves_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::RGBCurves);
+
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+
+	schema.sockets.push_back(color_output);
+
+	SocketDefinition rgb_curve_input(SocketIOType::INPUT, SocketType::CURVE, "RGB Curve", "rgb_curve");
+	rgb_curve_input.default_value = std::make_shared<CurveSocketValue>();
+	SocketDefinition r_curve_input(SocketIOType::INPUT, SocketType::CURVE, "Red Curve", "r_curve");
+	r_curve_input.default_value = std::make_shared<CurveSocketValue>();
+	SocketDefinition g_curve_input(SocketIOType::INPUT, SocketType::CURVE, "Green Curve", "g_curve");
+	g_curve_input.default_value = std::make_shared<CurveSocketValue>();
+	SocketDefinition b_curve_input(SocketIOType::INPUT, SocketType::CURVE, "Blue Curve", "b_curve");
+	b_curve_input.default_value = std::make_shared<CurveSocketValue>();
+	SocketDefinition fac_input(SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
+	fac_input.default_value = std::make_shared<FloatSocketValue>(1.0f, -1.0f, 1.0f);
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+
+	schema.sockets.push_back(rgb_curve_input);
+	schema.sockets.push_back(r_curve_input);
+	schema.sockets.push_back(g_curve_input);
+	schema.sockets.push_back(b_curve_input);
+	schema.sockets.push_back(fac_input);
+	schema.sockets.push_back(color_input);
+
+	return schema;
+}
+
+cse::RGBCurvesNode::RGBCurvesNode(const Float2 position) : EditableNode(get_static_schema<create_rgb_curves_schema>(), position)
+{
+
 }
 
 void cse::RGBCurvesNode::update_output_node(OutputNode& output)
@@ -206,20 +268,27 @@ void cse::RGBCurvesNode::update_output_node(OutputNode& output)
 	const auto g_curve_val = std::dynamic_pointer_cast<CurveSocketValue>(g_curve_socket->value);
 	const auto b_curve_val = std::dynamic_pointer_cast<CurveSocketValue>(b_curve_socket->value);
 
-	CurveEvaluator rgb_curve(rgb_curve_val);
-	CurveEvaluator r_curve(r_curve_val);
-	CurveEvaluator g_curve(g_curve_val);
-	CurveEvaluator b_curve(b_curve_val);
+	// Channel tables line up exactly with the output table, the rgb curve is looked up at arbitrary values so it uses a finer table
+	const CurveEvaluator rgb_curve(rgb_curve_val);
+	const CurveEvaluator r_curve(r_curve_val, CURVE_TABLE_SIZE - 1);
+	const CurveEvaluator g_curve(g_curve_val, CURVE_TABLE_SIZE - 1);
+	const CurveEvaluator b_curve(b_curve_val, CURVE_TABLE_SIZE - 1);
+
+	const std::vector<float>& r_samples = r_curve.get_samples();
+	const std::vector<float>& g_samples = g_curve.get_samples();
+	const std::vector<float>& b_samples = b_curve.get_samples();
 
 	OutputCurve out_r_curve;
 	OutputCurve out_g_curve;
 	OutputCurve out_b_curve;
+	out_r_curve.samples.reserve(CURVE_TABLE_SIZE);
+	out_g_curve.samples.reserve(CURVE_TABLE_SIZE);
+	out_b_curve.samples.reserve(CURVE_TABLE_SIZE);
 
 	for (unsigned int i = 0; i < CURVE_TABLE_SIZE; i++) {
-		const float x = static_cast<float>(i) / (CURVE_TABLE_SIZE - 1.0f);
-		out_r_curve.samples.push_back(rgb_curve.eval(r_curve.eval(x)));
-		out_g_curve.samples.push_back(rgb_curve.eval(g_curve.eval(x)));
-		out_b_curve.samples.push_back(rgb_curve.eval(b_curve.eval(x)));
+		out_r_curve.samples.push_back(rgb_curve.eval(r_samples[i]));
+		out_g_curve.samples.push_back(rgb_curve.eval(g_samples[i]));
+		out_b_curve.samples.push_back(rgb_curve.eval(b_samples[i]));
 	}
 
 	output.curve_values["final_r_curve"] = out_r_curve;
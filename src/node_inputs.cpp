@@ -8,267 +8,382 @@
 #include "util_enum.h"
 #include "util_vector.h"
 
-cse::AmbientOcculsionNode::AmbientOcculsionNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::AmbientOcclusion, "Ambient Occlusion")
+static cse::NodeSchema create_ambient_occulsion_schema()
 {
-	world_pos = position;
-
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
-	const auto ao_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "AO", "ao");
-
-	sockets.push_back(color_output);
-	sockets.push_back(ao_output);
-
-	const auto samples_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::INT, "Samples", "samples");
-	samples_input->value = std::make_shared<IntSocketValue>(16, 1, 128);
-	const auto inside_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::BOOLEAN, "Inside", "inside");
-	inside_input->value = std::make_shared<BoolSocketValue>(false);
-	const auto only_local_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::BOOLEAN, "Only Local", "only_local");
-	only_local_input->value = std::make_shared<BoolSocketValue>(false);
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto distance_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Distance", "distance");
-	distance_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 10000.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
-
-	sockets.push_back(samples_input);
-	sockets.push_back(inside_input);
-	sockets.push_back(only_local_input);
-	sockets.push_back(color_input);
-	sockets.push_back(distance_input);
-	sockets.push_back(normal_input);
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::AmbientOcclusion);
+
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+	SocketDefinition ao_output(SocketIOType::OUTPUT, SocketType::FLOAT, "AO", "ao");
+
+	schema.sockets.push_back(color_output);
+	schema.sockets.push_back(ao_output);
+
+	SocketDefinition samples_input(SocketIOType::INPUT, SocketType::INT, "Samples", "samples");
+	samples_input.default_value = std::make_shared<IntSocketValue>(16, 1, 128);
+	SocketDefinition inside_input(SocketIOType::INPUT, SocketType::BOOLEAN, "Inside", "inside");
+	inside_input.default_value = std::make_shared<BoolSocketValue>(false);
+	SocketDefinition only_local_input(SocketIOType::INPUT, SocketType::BOOLEAN, "Only Local", "only_local");
+	only_local_input.default_value = std::make_shared<BoolSocketValue>(false);
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition distance_input(SocketIOType::INPUT, SocketType::FLOAT, "Distance", "distance");
+	distance_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 10000.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+
+	schema.sockets.push_back(samples_input);
+	schema.sockets.push_back(inside_input);
+	schema.sockets.push_back(only_local_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(distance_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
 }
 
-cse::BevelNode::BevelNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::Bevel, "Bevel")
+cse::AmbientOcculsionNode::AmbientOcculsionNode(const Float2 position) : EditableNode(get_static_schema<create_ambient_occulsion_schema>(), position)
 {
-	world_pos = position;
 
-	const auto normal_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::NORMAL, "Normal", "normal");
+}
+
+static cse::NodeSchema create_bevel_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::Bevel);
+
+	SocketDefinition normal_output(SocketIOType::OUTPUT, SocketType::NORMAL, "Normal", "normal");
+
+	schema.sockets.push_back(normal_output);
+
+	SocketDefinition samples_input(SocketIOType::INPUT, SocketType::INT, "Samples", "samples");
+	samples_input.default_value = std::make_shared<IntSocketValue>(4, 2, 16);
+	SocketDefinition radius_input(SocketIOType::INPUT, SocketType::FLOAT, "Radius", "radius");
+	radius_input.default_value = std::make_shared<FloatSocketValue>(0.05f, 0.0f, 5000.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+
+	schema.sockets.push_back(samples_input);
+	schema.sockets.push_back(radius_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
+}
+
+cse::BevelNode::BevelNode(const Float2 position) : EditableNode(get_static_schema<create_bevel_schema>(), position)
+{
+
+}
+
+static cse::NodeSchema create_camera_data_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::CameraData);
+
+	SocketDefinition vector_output(SocketIOType::OUTPUT, SocketType::VECTOR, "View Vector", "view_vector");
+	SocketDefinition z_depth_output(SocketIOType::OUTPUT, SocketType::FLOAT, "View Z Depth", "view_z_depth");
+	SocketDefinition distance_output(SocketIOType::OUTPUT, SocketType::FLOAT, "View Distance", "view_distance");
+
+	schema.sockets.push_back(vector_output);
+	schema.sockets.push_back(z_depth_output);
+	schema.sockets.push_back(distance_output);
 
-	sockets.push_back(normal_output);
+	return schema;
+}
 
-	const auto samples_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::INT, "Samples", "samples");
-	samples_input->value = std::make_shared<IntSocketValue>(4, 2, 16);
-	const auto radius_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Radius", "radius");
-	radius_input->value = std::make_shared<FloatSocketValue>(0.05f, 0.0f, 5000.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+cse::CameraDataNode::CameraDataNode(const Float2 position) : EditableNode(get_static_schema<create_camera_data_schema>(), position)
+{
 
-	sockets.push_back(samples_input);
-	sockets.push_back(radius_input);
-	sockets.push_back(normal_input);
 }
 
-cse::CameraDataNode::CameraDataNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::CameraData, "Camera Data")
+static cse::NodeSchema create_fresnel_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::Fresnel);
+
+	SocketDefinition fac_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Fac", "fac");
+
+	schema.sockets.push_back(fac_output);
 
-	const auto vector_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "View Vector", "view_vector");
-	const auto z_depth_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "View Z Depth", "view_z_depth");
-	const auto distance_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "View Distance", "view_distance");
+	SocketDefinition ior_input(SocketIOType::INPUT, SocketType::FLOAT, "IOR", "IOR");
+	ior_input.default_value = std::make_shared<FloatSocketValue>(1.45f, 0.0f, 1000.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+
+	schema.sockets.push_back(ior_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
+}
+
+cse::FresnelNode::FresnelNode(const Float2 position) : EditableNode(get_static_schema<create_fresnel_schema>(), position)
+{
 
-	sockets.push_back(vector_output);
-	sockets.push_back(z_depth_output);
-	sockets.push_back(distance_output);
 }
 
-cse::FresnelNode::FresnelNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::Fresnel, "Fresnel")
+static cse::NodeSchema create_geometry_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::Geometry);
+
+	SocketDefinition position_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Position", "position");
+	SocketDefinition normal_output(SocketIOType::OUTPUT, SocketType::NORMAL, "Normal", "normal");
+	SocketDefinition tangent_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Tangent", "tangent");
+	SocketDefinition true_normal_output(SocketIOType::OUTPUT, SocketType::NORMAL, "True Normal", "true_normal");
+	SocketDefinition incoming_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Incoming", "incoming");
+	SocketDefinition parametric_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Parametric", "parametric");
+	SocketDefinition backfacing_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Backfacing", "backfacing");
+	SocketDefinition pointiness_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Pointiness", "pointiness");
+	SocketDefinition random_per_island_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Random Per Island", "random_per_island");
+
+	schema.sockets.push_back(position_output);
+	schema.sockets.push_back(normal_output);
+	schema.sockets.push_back(tangent_output);
+	schema.sockets.push_back(true_normal_output);
+	schema.sockets.push_back(incoming_output);
+	schema.sockets.push_back(parametric_output);
+	schema.sockets.push_back(backfacing_output);
+	schema.sockets.push_back(pointiness_output);
+	schema.sockets.push_back(random_per_island_output);
+
+	return schema;
+}
+
+cse::GeometryNode::GeometryNode(const Float2 position) : EditableNode(get_static_schema<create_geometry_schema>(), position)
+{
+
+}
+
+static cse::NodeSchema create_layer_weight_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::LayerWeight);
+
+	SocketDefinition fresnel_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Fresnel", "fresnel");
+	SocketDefinition facing_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Facing", "facing");
 
-	const auto fac_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Fac", "fac");
+	schema.sockets.push_back(fresnel_output);
+	schema.sockets.push_back(facing_output);
 
-	sockets.push_back(fac_output);
+	SocketDefinition blend_input(SocketIOType::INPUT, SocketType::FLOAT, "Blend", "blend");
+	blend_input.default_value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
 
-	const auto ior_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "IOR", "IOR");
-	ior_input->value = std::make_shared<FloatSocketValue>(1.45f, 0.0f, 1000.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+	schema.sockets.push_back(blend_input);
+	schema.sockets.push_back(normal_input);
 
-	sockets.push_back(ior_input);
-	sockets.push_back(normal_input);
+	return schema;
 }
 
-cse::GeometryNode::GeometryNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::Geometry, "Geometry")
+cse::LayerWeightNode::LayerWeightNode(const Float2 position) : EditableNode(get_static_schema<create_layer_weight_schema>(), position)
 {
-	world_pos = position;
-
-	const auto position_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Position", "position");
-	const auto normal_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::NORMAL, "Normal", "normal");
-	const auto tangent_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Tangent", "tangent");
-	const auto true_normal_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::NORMAL, "True Normal", "true_normal");
-	const auto incoming_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Incoming", "incoming");
-	const auto parametric_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Parametric", "parametric");
-	const auto backfacing_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Backfacing", "backfacing");
-	const auto pointiness_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Pointiness", "pointiness");
-	const auto random_per_island_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Random Per Island", "random_per_island");
-
-	sockets.push_back(position_output);
-	sockets.push_back(normal_output);
-	sockets.push_back(tangent_output);
-	sockets.push_back(true_normal_output);
-	sockets.push_back(incoming_output);
-	sockets.push_back(parametric_output);
-	sockets.push_back(backfacing_output);
-	sockets.push_back(pointiness_output);
-	sockets.push_back(random_per_island_output);
+
+}
+
+static cse::NodeSchema create_light_path_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::LightPath);
+
+	SocketDefinition camera_ray_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Is Camera Ray", "is_camera_ray");
+	SocketDefinition shadow_ray_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Is Shadow Ray", "is_shadow_ray");
+	SocketDefinition diffuse_ray_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Is Diffuse Ray", "is_diffuse_ray");
+	SocketDefinition glossy_ray_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Is Glossy Ray", "is_glossy_ray");
+	SocketDefinition singular_ray_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Is Singular Ray", "is_singular_ray");
+	SocketDefinition reflection_ray_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Is Reflection Ray", "is_reflection_ray");
+	SocketDefinition transmission_ray_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Is Transmission Ray", "is_transmission_ray");
+	SocketDefinition ray_length_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Ray Length", "ray_length");
+	SocketDefinition ray_depth_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Ray Depth", "ray_depth");
+	SocketDefinition diffuse_depth_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Diffuse Depth", "diffuse_depth");
+	SocketDefinition glossy_depth_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Glossy Depth", "glossy_depth");
+	SocketDefinition transparent_depth_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Transparent Depth", "transparent_depth");
+	SocketDefinition transmission_depth_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Transmission Depth", "transmission_depth");
+
+	schema.sockets.push_back(camera_ray_output);
+	schema.sockets.push_back(shadow_ray_output);
+	schema.sockets.push_back(diffuse_ray_output);
+	schema.sockets.push_back(glossy_ray_output);
+	schema.sockets.push_back(singular_ray_output);
+	schema.sockets.push_back(reflection_ray_output);
+	schema.sockets.push_back(transmission_ray_output);
+	schema.sockets.push_back(ray_length_output);
+	schema.sockets.push_back(ray_depth_output);
+	schema.sockets.push_back(diffuse_depth_output);
+	schema.sockets.push_back(glossy_depth_output);
+	schema.sockets.push_back(transparent_depth_output);
+	schema.sockets.push_back(transmission_depth_output);
+
+	return schema;
+}
+
+cse::LightPathNode::LightPathNode(const Float2 position) : EditableNode(get_static_schema<create_light_path_schema>(), position)
+{
+
 }
 
-cse::LayerWeightNode::LayerWeightNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::LayerWeight, "Layer Weight")
+static cse::NodeSchema create_object_info_schema()
 {
-	world_pos = position;
+	using namespace cse;
 
-	const auto fresnel_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Fresnel", "fresnel");
-	const auto facing_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Facing", "facing");
+	NodeSchema schema(CyclesNodeType::ObjectInfo);
 
-	sockets.push_back(fresnel_output);
-	sockets.push_back(facing_output);
+	SocketDefinition location_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Location", "location");
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+	SocketDefinition object_index_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Object Index", "object_index");
+	SocketDefinition material_index_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Material Index", "material_index");
+	SocketDefinition random_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Random", "random");
 
-	const auto blend_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Blend", "blend");
-	blend_input->value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+	schema.sockets.push_back(location_output);
+	schema.sockets.push_back(color_output);
+	schema.sockets.push_back(object_index_output);
+	schema.sockets.push_back(material_index_output);
+	schema.sockets.push_back(random_output);
 
-	sockets.push_back(blend_input);
-	sockets.push_back(normal_input);
+	return schema;
 }
 
-cse::LightPathNode::LightPathNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::LightPath, "Light Path")
+cse::ObjectInfoNode::ObjectInfoNode(const Float2 position) : EditableNode(get_static_schema<create_object_info_schema>(), position)
 {
-	world_pos = position;
-
-	const auto camera_ray_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Is Camera Ray", "is_camera_ray");
-	const auto shadow_ray_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Is Shadow Ray", "is_shadow_ray");
-	const auto diffuse_ray_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Is Diffuse Ray", "is_diffuse_ray");
-	const auto glossy_ray_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Is Glossy Ray", "is_glossy_ray");
-	const auto singular_ray_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Is Singular Ray", "is_singular_ray");
-	const auto reflection_ray_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Is Reflection Ray", "is_reflection_ray");
-	const auto transmission_ray_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Is Transmission Ray", "is_transmission_ray");
-	const auto ray_length_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Ray Length", "ray_length");
-	const auto ray_depth_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Ray Depth", "ray_depth");
-	const auto diffuse_depth_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Diffuse Depth", "diffuse_depth");
-	const auto glossy_depth_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Glossy Depth", "glossy_depth");
-	const auto transparent_depth_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Transparent Depth", "transparent_depth");
-	const auto transmission_depth_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Transmission Depth", "transmission_depth");
-
-	sockets.push_back(camera_ray_output);
-	sockets.push_back(shadow_ray_output);
-	sockets.push_back(diffuse_ray_output);
-	sockets.push_back(glossy_ray_output);
-	sockets.push_back(singular_ray_output);
-	sockets.push_back(reflection_ray_output);
-	sockets.push_back(transmission_ray_output);
-	sockets.push_back(ray_length_output);
-	sockets.push_back(ray_depth_output);
-	sockets.push_back(diffuse_depth_output);
-	sockets.push_back(glossy_depth_output);
-	sockets.push_back(transparent_depth_output);
-	sockets.push_back(transmission_depth_output);
+
 }
 
-cse::ObjectInfoNode::ObjectInfoNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::ObjectInfo, "Object Info")
+static cse::NodeSchema create_rgb_schema()
 {
-	world_pos = position;
-
-	const auto location_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Location", "location");
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
-	const auto object_index_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Object Index", "object_index");
-	const auto material_index_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Material Index", "material_index");
-	const auto random_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Random", "random");
-
-	sockets.push_back(location_output);
-	sockets.push_back(color_output);
-	sockets.push_back(object_index_output);
-	sockets.push_back(material_index_output);
-	sockets.push_back(random_output);
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::RGB);
+
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+
+	schema.sockets.push_back(color_output);
+
+	SocketDefinition value_input(SocketIOType::INPUT, SocketType::COLOR, "Value", "value");
+	value_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	value_input.draw_socket = false;
+
+	schema.sockets.push_back(value_input);
+
+	return schema;
+}
+
+cse::RGBNode::RGBNode(const Float2 position) : EditableNode(get_static_schema<create_rgb_schema>(), position)
+{
+
 }
 
-cse::RGBNode::RGBNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::RGB, "RGB")
+static cse::NodeSchema create_tangent_schema()
 {
-	world_pos = position;
+	using namespace cse;
 
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+	NodeSchema schema(CyclesNodeType::Tangent);
 
-	sockets.push_back(color_output);
+	SocketDefinition tangent_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Tangent", "tangent");
 
-	const auto value_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Value", "value");
-	value_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	value_input->draw_socket = false;
+	schema.sockets.push_back(tangent_output);
+
+	SocketDefinition direction_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Direction", "direction");
+	std::vector<StringEnumPair> direction_enum_values;
+	direction_enum_values.push_back(StringEnumPair("Radial", "radial"));
+	direction_enum_values.push_back(StringEnumPair("UV Map", "uv_map"));
+	direction_input.default_value = std::make_shared<StringEnumSocketValue>(direction_enum_values, "radial");
+	SocketDefinition axis_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Radial Axis", "axis");
+	std::vector<StringEnumPair> axis_enum_values;
+	axis_enum_values.push_back(StringEnumPair("X", "x"));
+	axis_enum_values.push_back(StringEnumPair("Y", "y"));
+	axis_enum_values.push_back(StringEnumPair("Z", "z"));
+	axis_input.default_value = std::make_shared<StringEnumSocketValue>(axis_enum_values, "z");
+
+	schema.sockets.push_back(direction_input);
+	schema.sockets.push_back(axis_input);
+
+	return schema;
+}
+
+cse::TangentNode::TangentNode(const Float2 position) : EditableNode(get_static_schema<create_tangent_schema>(), position)
+{
 
-	sockets.push_back(value_input);
 }
 
-cse::TangentNode::TangentNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::Tangent, "Tangent")
+static cse::NodeSchema create_texture_coordinate_schema()
 {
-	world_pos = position;
-
-	const auto tangent_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Tangent", "tangent");
-
-	sockets.push_back(tangent_output);
-
-	const auto direction_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Direction", "direction");
-	const auto direction_value = std::make_shared<StringEnumSocketValue>();
-	direction_value->enum_values.push_back(StringEnumPair("Radial", "radial"));
-	direction_value->enum_values.push_back(StringEnumPair("UV Map", "uv_map"));
-	direction_value->set_from_internal_name("radial");
-	direction_input->value = direction_value;
-	const auto axis_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Radial Axis", "axis");
-	const auto axis_value = std::make_shared<StringEnumSocketValue>();
-	axis_value->enum_values.push_back(StringEnumPair("X", "x"));
-	axis_value->enum_values.push_back(StringEnumPair("Y", "y"));
-	axis_value->enum_values.push_back(StringEnumPair("Z", "z"));
-	axis_value->set_from_internal_name("z");
-	axis_input->value = axis_value;
-
-	sockets.push_back(direction_input);
-	sockets.push_back(axis_input);
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::TextureCoordinate);
+
+	SocketDefinition generated_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Generated", "generated");
+	SocketDefinition normal_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Normal", "normal");
+	SocketDefinition uv_output(SocketIOType::OUTPUT, SocketType::VECTOR, "UV", "UV");
+	SocketDefinition object_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Object", "object");
+	SocketDefinition camera_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Camera", "camera");
+	SocketDefinition window_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Window", "window");
+	SocketDefinition reflection_output(SocketIOType::OUTPUT, SocketType::VECTOR, "Reflection", "reflection");
+
+	schema.sockets.push_back(generated_output);
+	schema.sockets.push_back(normal_output);
+	schema.sockets.push_back(uv_output);
+	schema.sockets.push_back(object_output);
+	schema.sockets.push_back(camera_output);
+	schema.sockets.push_back(window_output);
+	schema.sockets.push_back(reflection_output);
+
+	return schema;
 }
 
-cse::TextureCoordinateNode::TextureCoordinateNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::TextureCoordinate, "Texture Coordinate")
+cse::TextureCoordinateNode::TextureCoordinateNode(const Float2 position) : EditableNode(get_static_schema<create_texture_coordinate_schema>(), position)
 {
-	world_pos = position;
-
-	const auto generated_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Generated", "generated");
-	const auto normal_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Normal", "normal");
-	const auto uv_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "UV", "UV");
-	const auto object_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Object", "object");
-	const auto camera_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Camera", "camera");
-	const auto window_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Window", "window");
-	const auto reflection_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::VECTOR, "Reflection", "reflection");
-
-	sockets.push_back(generated_output);
-	sockets.push_back(normal_output);
-	sockets.push_back(uv_output);
-	sockets.push_back(object_output);
-	sockets.push_back(camera_output);
-	sockets.push_back(window_output);
-	sockets.push_back(reflection_output);
+
 }
 
-cse::ValueNode::ValueNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::Value, "Value")
+static cse::NodeSchema create_value_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::Value);
 
-	const auto value_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Value", "value");
+	SocketDefinition value_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Value", "value");
 
-	sockets.push_back(value_output);
+	schema.sockets.push_back(value_output);
 
-	const auto value_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Value", "value");
-	value_input->value = std::make_shared<FloatSocketValue>(0.0f, -10000.0f, 10000.0f);
-	value_input->draw_socket = false;
+	SocketDefinition value_input(SocketIOType::INPUT, SocketType::FLOAT, "Value", "value");
+	value_input.default_value = std::make_shared<FloatSocketValue>(0.0f, -10000.0f, 10000.0f);
+	value_input.draw_socket = false;
 
-	sockets.push_back(value_input);
+	schema.sockets.push_back(value_input);
+
+	return schema;
 }
 
-cse::WireframeNode::WireframeNode(const Float2 position) : EditableNode(NodeCategory::INPUT, CyclesNodeType::Wireframe, "Wireframe")
+cse::ValueNode::ValueNode(const Float2 position) : EditableNode(get_static_schema<create_value_schema>(), position)
 {
-	world_pos = position;
 
-	const auto fac_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Fac", "fac");
+}
 
-	sockets.push_back(fac_output);
+static cse::NodeSchema create_wireframe_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::Wireframe);
+
+	SocketDefinition fac_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Fac", "fac");
+
+	schema.sockets.push_back(fac_output);
+
+	SocketDefinition pixel_size_input(SocketIOType::INPUT, SocketType::BOOLEAN, "Use Pixel Size", "use_pixel_size");
+	pixel_size_input.default_value = std::make_shared<BoolSocketValue>(false);
+	SocketDefinition size_input(SocketIOType::INPUT, SocketType::FLOAT, "Size", "size");
+	size_input.default_value = std::make_shared<FloatSocketValue>(0.04f, 0.0f, 10000.0f);
 
-	const auto pixel_size_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::BOOLEAN, "Use Pixel Size", "use_pixel_size");
-	pixel_size_input->value = std::make_shared<BoolSocketValue>(false);
-	const auto size_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Size", "size");
-	size_input->value = std::make_shared<FloatSocketValue>(0.04f, 0.0f, 10000.0f);
+	schema.sockets.push_back(pixel_size_input);
+	schema.sockets.push_back(size_input);
+
+	return schema;
+}
+
+cse::WireframeNode::WireframeNode(const Float2 position) : EditableNode(get_static_schema<create_wireframe_schema>(), position)
+{
 
-	sockets.push_back(pixel_size_input);
-	sockets.push_back(size_input);
 }
@@ -8,36 +8,44 @@
 #include "util_enum.h"
 #include "util_vector.h"
 
-cse::MaxTexmapShaderNode::MaxTexmapShaderNode(const Float2 position) : EditableNode(NodeCategory::TEXTURE, CyclesNodeType::MaxTex, "3ds Max Texmap")
+static cse::NodeSchema create_max_texmap_shader_schema()
 {
-	world_pos = position;
-
-	const auto color_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
-	const auto alpha_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::FLOAT, "Alpha", "alpha");
-
-	sockets.push_back(color_output);
-	sockets.push_back(alpha_output);
-
-	const auto slot_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::INT, "Slot", "slot");
-	slot_input->value = std::make_shared<IntSocketValue>(1, 1, 32);
-	const auto autosize_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::BOOLEAN, "Auto-size", "autosize");
-	autosize_input->value = std::make_shared<BoolSocketValue>(true);
-	const auto width_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::INT, "Width", "width");
-	width_input->value = std::make_shared<IntSocketValue>(512, 1, 32768);
-	const auto height_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::INT, "Height", "height");
-	height_input->value = std::make_shared<IntSocketValue>(512, 1, 32768);
-	const auto precision_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Precision", "precision");
-	const auto precision_value = std::make_shared<StringEnumSocketValue>();
-	precision_value->enum_values.push_back(StringEnumPair("8-bit/Channel Int", "uchar"));
-	precision_value->enum_values.push_back(StringEnumPair("32-bit/Channel Float", "float"));
-	precision_value->set_from_internal_name("uchar");
-	precision_input->value = precision_value;
-	const auto vector_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::VECTOR, "Vector", "vector");
-
-	sockets.push_back(slot_input);
-	sockets.push_back(autosize_input);
-	sockets.push_back(width_input);
-	sockets.push_back(height_input);
-	sockets.push_back(precision_input);
-	sockets.push_back(vector_input);
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::MaxTex);
+
+	SocketDefinition color_output(SocketIOType::OUTPUT, SocketType::COLOR, "Color", "color");
+	SocketDefinition alpha_output(SocketIOType::OUTPUT, SocketType::FLOAT, "Alpha", "alpha");
+
+	schema.sockets.push_back(color_output);
+	schema.sockets.push_back(alpha_output);
+
+	SocketDefinition slot_input(SocketIOType::INPUT, SocketType::INT, "Slot", "slot");
+	slot_input.default_value = std::make_shared<IntSocketValue>(1, 1, 32);
+	SocketDefinition autosize_input(SocketIOType::INPUT, SocketType::BOOLEAN, "Auto-size", "autosize");
+	autosize_input.default_value = std::make_shared<BoolSocketValue>(true);
+	SocketDefinition width_input(SocketIOType::INPUT, SocketType::INT, "Width", "width");
+	width_input.default_value = std::make_shared<IntSocketValue>(512, 1, 32768);
+	SocketDefinition height_input(SocketIOType::INPUT, SocketType::INT, "Height", "height");
+	height_input.default_value = std::make_shared<IntSocketValue>(512, 1, 32768);
+	SocketDefinition precision_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Precision", "precision");
+	std::vector<StringEnumPair> precision_enum_values;
+	precision_enum_values.push_back(StringEnumPair("8-bit/Channel Int", "uchar"));
+	precision_enum_values.push_back(StringEnumPair("32-bit/Channel Float", "float"));
+	precision_input.default_value = std::make_shared<StringEnumSocketValue>(precision_enum_values, "uchar");
+	SocketDefinition vector_input(SocketIOType::INPUT, SocketType::VECTOR, "Vector", "vector");
+
+	schema.sockets.push_back(slot_input);
+	schema.sockets.push_back(autosize_input);
+	schema.sockets.push_back(width_input);
+	schema.sockets.push_back(height_input);
+	schema.sockets.push_back(precision_input);
+	schema.sockets.push_back(vector_input);
+
+	return schema;
+}
+
+cse::MaxTexmapShaderNode::MaxTexmapShaderNode(const Float2 position) : EditableNode(get_static_schema<create_max_texmap_shader_schema>(), position)
+{
+
 }
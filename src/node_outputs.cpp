@@ -8,18 +8,25 @@
 #include "util_enum.h"
 #include "util_vector.h"
 
-cse::MaterialOutputNode::MaterialOutputNode(const Float2 position) : EditableNode(NodeCategory::OUTPUT, CyclesNodeType::MaterialOutput, "Material Output")
+static cse::NodeSchema create_material_output_schema()
 {
-	world_pos = position;
+	using namespace cse;
 
-	const auto surface_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CLOSURE, "Surface", "surface");
-	const auto volume_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CLOSURE, "Volume", "volume");
-	const auto displacement_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::VECTOR, "Displacement", "displacement");
+	NodeSchema schema(CyclesNodeType::MaterialOutput);
 
-	sockets.push_back(surface_input);
-	sockets.push_back(volume_input);
-	sockets.push_back(displacement_input);
+	SocketDefinition surface_input(SocketIOType::INPUT, SocketType::CLOSURE, "Surface", "surface");
+	SocketDefinition volume_input(SocketIOType::INPUT, SocketType::CLOSURE, "Volume", "volume");
+	SocketDefinition displacement_input(SocketIOType::INPUT, SocketType::VECTOR, "Displacement", "displacement");
 
+	schema.sockets.push_back(surface_input);
+	schema.sockets.push_back(volume_input);
+	schema.sockets.push_back(displacement_input);
+
+	return schema;
+}
+
+cse::MaterialOutputNode::MaterialOutputNode(const Float2 position) : EditableNode(get_static_schema<create_material_output_schema>(), position)
+{
 	// This node being added should not trigger an update to undo state
 	changed = false;
 }
@@ -0,0 +1,236 @@
+#include "node_raster_cache.h"
+
+#include <cmath>
+#include <cstddef>
+
+#include <nanovg.h>
+
+#include "gui_sizes.h"
+#include "node_base.h"
+#include "sockets.h"
+#include "util_hash.h"
+#include "util_vector.h"
+#include "wrapper_nvg_framebuffer.h"
+
+// Width and height of the atlas, in pixels
+static constexpr int ATLAS_SIZE = 2048;
+
+// Sockets are drawn centered on the node's edges, so the image needs to extend a little past the node's bounds
+static constexpr float NODE_IMAGE_MARGIN = UI_NODE_SOCKET_RADIUS + 2.0f;
+
+cse::NodeRasterCache::NodeRasterCache()
+{
+
+}
+
+cse::NodeRasterCache::~NodeRasterCache()
+{
+	// Empty destructor is needed so incomplete NvgFramebuffer type can be used in the header
+}
+
+void cse::NodeRasterCache::update(
+	NVGcontext* const draw_context,
+	const std::vector<std::shared_ptr<EditableNode>>& nodes,
+	const float zoom_scale,
+	const float new_px_ratio,
+	const std::shared_ptr<NodeSocket>& selected_socket
+	)
+{
+	if (disabled) {
+		return;
+	}
+	if (atlas == nullptr) {
+		// Images are drawn aligned to pixels so they are copied exactly, linear filtering only matters when the view is drawn at a reduced resolution
+		atlas = std::make_unique<NvgFramebuffer>(draw_context, ATLAS_SIZE, ATLAS_SIZE, 0);
+		if (atlas->is_valid() == false) {
+			atlas.reset();
+			disabled = true;
+			return;
+		}
+	}
+
+	const float new_raster_scale = zoom_scale * new_px_ratio;
+	if (new_raster_scale != raster_scale) {
+		clear();
+		raster_scale = new_raster_scale;
+		px_ratio = new_px_ratio;
+		image_padding = static_cast<int>(std::ceil(NODE_IMAGE_MARGIN * raster_scale));
+	}
+
+	update_count++;
+
+	std::vector<CacheEntry*> entries_to_render;
+	for (int attempt = 0; attempt < 2; attempt++) {
+		entries_to_render.clear();
+		std::size_t entries_used = 0;
+		bool out_of_space = false;
+		for (const auto& this_node : nodes) {
+			const std::uint64_t appearance_hash = this_node->get_appearance_hash(this_node->selected, selected_socket);
+
+			auto entry_iter = entries.find(this_node.get());
+			if (entry_iter != entries.end() && entry_iter->second.node.lock() != this_node) {
+				// The node this entry was created for no longer exists and a new node has the same address
+				entries.erase(entry_iter);
+				entry_iter = entries.end();
+			}
+
+			if (entry_iter != entries.end()) {
+				CacheEntry& entry = entry_iter->second;
+				entry.last_update = update_count;
+				entries_used++;
+				if (entry.appearance_hash != appearance_hash) {
+					// Node sizes never change, so the image can be redrawn in place
+					entry.appearance_hash = appearance_hash;
+					entries_to_render.push_back(&entry);
+				}
+				continue;
+			}
+
+			const Float2 node_size = this_node->get_dimensions();
+			const int image_width = static_cast<int>(std::ceil(node_size.x * raster_scale)) + image_padding * 2;
+			const int image_height = static_cast<int>(std::ceil(node_size.y * raster_scale)) + image_padding * 2;
+
+			CacheEntry new_entry;
+			if (allocate(image_width, image_height, new_entry) == false) {
+				out_of_space = true;
+				continue;
+			}
+			new_entry.node = this_node;
+			new_entry.appearance_hash = appearance_hash;
+			new_entry.last_update = update_count;
+			CacheEntry& entry = entries[this_node.get()] = new_entry;
+			entries_used++;
+			entries_to_render.push_back(&entry);
+		}
+
+		// If some of the atlas is held by nodes that were not needed this time, start over with only the nodes that are needed
+		if (out_of_space == false || entries_used == entries.size()) {
+			break;
+		}
+		clear();
+	}
+
+	if (entries_to_render.empty()) {
+		return;
+	}
+
+	atlas->bind();
+	for (const CacheEntry* const this_entry : entries_to_render) {
+		atlas->clear_region(this_entry->x, this_entry->y, this_entry->width, this_entry->height);
+	}
+
+	nvgBeginFrame(draw_context, static_cast<float>(atlas->width), static_cast<float>(atlas->height), 1.0f);
+	for (const CacheEntry* const this_entry : entries_to_render) {
+		const std::shared_ptr<EditableNode> this_node = this_entry->node.lock();
+		nvgSave(draw_context);
+		nvgScissor(draw_context,
+			static_cast<float>(this_entry->x),
+			static_cast<float>(this_entry->y),
+			static_cast<float>(this_entry->width),
+			static_cast<float>(this_entry->height)
+		);
+		nvgTranslate(draw_context, static_cast<float>(this_entry->x + image_padding), static_cast<float>(this_entry->y + image_padding));
+		nvgScale(draw_context, raster_scale, raster_scale);
+		this_node->draw_node(draw_context, body_shapes, this_node->selected, selected_socket);
+		nvgRestore(draw_context);
+	}
+	nvgEndFrame(draw_context);
+
+	NvgFramebuffer::unbind();
+}
+
+bool cse::NodeRasterCache::draw_node(NVGcontext* const draw_context, const EditableNode* const node) const
+{
+	if (atlas == nullptr) {
+		return false;
+	}
+	const auto entry_iter = entries.find(node);
+	if (entry_iter == entries.end() || entry_iter->second.last_update != update_count) {
+		return false;
+	}
+	const CacheEntry& entry = entry_iter->second;
+
+	// Move the origin to the nearest pixel so each atlas pixel lands on exactly one screen pixel
+	float xform[6];
+	nvgCurrentTransform(draw_context, xform);
+	const float origin_px_x = xform[4] * px_ratio;
+	const float origin_px_y = xform[5] * px_ratio;
+	const float offset_x = (std::round(origin_px_x) - origin_px_x) / raster_scale;
+	const float offset_y = (std::round(origin_px_y) - origin_px_y) / raster_scale;
+
+	const float image_x = offset_x - (entry.x + image_padding) / raster_scale;
+	const float image_y = offset_y - (entry.y + image_padding) / raster_scale;
+	const float atlas_size = atlas->width / raster_scale;
+	const NVGpaint atlas_paint = nvgImagePattern(draw_context, image_x, image_y, atlas_size, atlas_size, 0.0f, atlas->get_image(), 1.0f);
+
+	nvgBeginPath(draw_context);
+	nvgRect(draw_context,
+		offset_x - image_padding / raster_scale,
+		offset_y - image_padding / raster_scale,
+		entry.width / raster_scale,
+		entry.height / raster_scale
+	);
+	nvgFillPaint(draw_context, atlas_paint);
+	nvgFill(draw_context);
+
+	return true;
+}
+
+bool cse::NodeRasterCache::get_node_key(const EditableNode* const node, std::uint64_t& key) const
+{
+	if (atlas == nullptr) {
+		return false;
+	}
+	const auto entry_iter = entries.find(node);
+	if (entry_iter == entries.end() || entry_iter->second.last_update != update_count) {
+		return false;
+	}
+	const CacheEntry& entry = entry_iter->second;
+
+	// The image's contents are not part of the key, an image updated in place is picked up by anything that draws it
+	key = HASH_SEED;
+	hash_value(key, atlas->get_image());
+	hash_value(key, entry.x);
+	hash_value(key, entry.y);
+	hash_value(key, entry.width);
+	hash_value(key, entry.height);
+	hash_value(key, raster_scale);
+	hash_value(key, px_ratio);
+	return true;
+}
+
+void cse::NodeRasterCache::clear()
+{
+	entries.clear();
+	body_shapes.remove_unused();
+	shelf_x = 0;
+	shelf_y = 0;
+	shelf_height = 0;
+}
+
+bool cse::NodeRasterCache::allocate(const int width, const int height, CacheEntry& entry)
+{
+	if (width > ATLAS_SIZE || height > ATLAS_SIZE) {
+		return false;
+	}
+	if (shelf_x + width > ATLAS_SIZE) {
+		// Start a new row
+		shelf_x = 0;
+		shelf_y += shelf_height;
+		shelf_height = 0;
+	}
+	if (shelf_y + height > ATLAS_SIZE) {
+		return false;
+	}
+
+	entry.x = shelf_x;
+	entry.y = shelf_y;
+	entry.width = width;
+	entry.height = height;
+
+	shelf_x += width;
+	if (height > shelf_height) {
+		shelf_height = height;
+	}
+	return true;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "node_body_shapes.h"
+
+struct NVGcontext;
+
+namespace cse {
+
+	class EditableNode;
+	class NodeSocket;
+	class NvgFramebuffer;
+
+	// Keeps rendered images of nodes in an offscreen atlas so unchanged nodes can be drawn as a single textured quad
+	// Everything in the atlas is rendered at one zoom level, changing the zoom discards the whole atlas
+	class NodeRasterCache {
+	public:
+		NodeRasterCache();
+		~NodeRasterCache();
+
+		// Renders any of the given nodes that are missing from the atlas or have changed since they were rendered
+		// This begins and ends its own nanovg frame, so it must be called before the main frame begins
+		void update(
+			NVGcontext* draw_context,
+			const std::vector<std::shared_ptr<EditableNode>>& nodes,
+			float zoom_scale,
+			float px_ratio,
+			const std::shared_ptr<NodeSocket>& selected_socket
+		);
+
+		// Draws a node from the atlas with the node's origin at the current origin
+		// Returns false if the node was not part of the last update, in which case the caller must draw it normally
+		bool draw_node(NVGcontext* draw_context, const EditableNode* node) const;
+
+		// Identifies where in the atlas a node's image is, this changes whenever draw_node would draw the node differently
+		// Returns false if draw_node would return false for this node
+		bool get_node_key(const EditableNode* node, std::uint64_t& key) const;
+
+		void clear();
+
+	private:
+		class CacheEntry {
+		public:
+			std::weak_ptr<EditableNode> node;
+			std::uint64_t appearance_hash = 0;
+			unsigned int last_update = 0;
+
+			// Area of the atlas holding this node's image, in pixels
+			int x = 0;
+			int y = 0;
+			int width = 0;
+			int height = 0;
+		};
+
+		// Finds space in the atlas for an image of the given size, returns false if there is not enough space left
+		bool allocate(int width, int height, CacheEntry& entry);
+
+		std::unique_ptr<NvgFramebuffer> atlas;
+		// Set if the atlas could not be created, usually because the driver does not support framebuffers
+		bool disabled = false;
+
+		std::map<const EditableNode*, CacheEntry> entries;
+		unsigned int update_count = 0;
+
+		NodeBodyShapes body_shapes;
+
+		// Scale from world space to atlas pixels
+		float raster_scale = 0.0f;
+		float px_ratio = 1.0f;
+		// Space between a node's bounds and the edge of its image, in pixels
+		int image_padding = 0;
+
+		// Images are packed left to right in rows, a new row starts below the tallest image in the current row
+		int shelf_x = 0;
+		int shelf_y = 0;
+		int shelf_height = 0;
+	};
+
+}
@@ -0,0 +1,208 @@
+#include "node_registry.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "config.h"
+
+#include "node_base.h"
+#include "node_colors.h"
+#include "node_converter.h"
+#include "node_inputs.h"
+#include "node_interop_max.h"
+#include "node_outputs.h"
+#include "node_shaders.h"
+#include "node_textures.h"
+#include "node_vector.h"
+#include "util_vector.h"
+
+#ifdef INCLUDE_MAX_INTEGRATION
+static constexpr bool MAX_TEX_IN_NODE_LIST = true;
+#else
+static constexpr bool MAX_TEX_IN_NODE_LIST = false;
+#endif
+
+template<typename T>
+static std::shared_ptr<cse::EditableNode> create_node_of_type(const cse::Float2 position)
+{
+	return std::make_shared<T>(position);
+}
+
+// Must be in the same order as CyclesNodeType, this is checked below
+static constexpr cse::NodeTypeInfo NODE_TYPES[] = {
+	// Shader
+	{ cse::CyclesNodeType::PrincipledBSDF, "principled_bsdf", cse::NodeCategory::SHADER, "Principled BSDF", true, create_node_of_type<cse::PrincipledBSDFNode> },
+	{ cse::CyclesNodeType::PrincipledVolume, "principled_volume", cse::NodeCategory::SHADER, "Principled Volume", true, create_node_of_type<cse::PrincipledVolumeNode> },
+	{ cse::CyclesNodeType::PrincipledHair, "principled_hair", cse::NodeCategory::SHADER, "Principled Hair", true, create_node_of_type<cse::PrincipledHairNode> },
+	{ cse::CyclesNodeType::MixShader, "mix_shader", cse::NodeCategory::SHADER, "Mix Shader", true, create_node_of_type<cse::MixShaderNode> },
+	{ cse::CyclesNodeType::AddShader, "add_shader", cse::NodeCategory::SHADER, "Add Shader", true, create_node_of_type<cse::AddShaderNode> },
+	{ cse::CyclesNodeType::DiffuseBSDF, "diffuse_bsdf", cse::NodeCategory::SHADER, "Diffuse BSDF", true, create_node_of_type<cse::DiffuseBSDFNode> },
+	{ cse::CyclesNodeType::GlossyBSDF, "glossy_bsdf", cse::NodeCategory::SHADER, "Glossy BSDF", true, create_node_of_type<cse::GlossyBSDFNode> },
+	{ cse::CyclesNodeType::TransparentBSDF, "transparent_bsdf", cse::NodeCategory::SHADER, "Transparent BSDF", true, create_node_of_type<cse::TransparentBSDFNode> },
+	{ cse::CyclesNodeType::RefractionBSDF, "refraction_bsdf", cse::NodeCategory::SHADER, "Refraction BSDF", true, create_node_of_type<cse::RefractionBSDFNode> },
+	{ cse::CyclesNodeType::GlassBSDF, "glass_bsdf", cse::NodeCategory::SHADER, "Glass BSDF", true, create_node_of_type<cse::GlassBSDFNode> },
+	{ cse::CyclesNodeType::TranslucentBSDF, "translucent_bsdf", cse::NodeCategory::SHADER, "Translucent BSDF", true, create_node_of_type<cse::TranslucentBSDFNode> },
+	{ cse::CyclesNodeType::AnisotropicBSDF, "anisotropic_bsdf", cse::NodeCategory::SHADER, "Anisotropic BSDF", true, create_node_of_type<cse::AnisotropicBSDFNode> },
+	{ cse::CyclesNodeType::VelvetBSDF, "velvet_bsdf", cse::NodeCategory::SHADER, "Velvet BSDF", true, create_node_of_type<cse::VelvetBSDFNode> },
+	{ cse::CyclesNodeType::ToonBSDF, "toon_bsdf", cse::NodeCategory::SHADER, "Toon BSDF", true, create_node_of_type<cse::ToonBSDFNode> },
+	{ cse::CyclesNodeType::SubsurfaceScattering, "subsurface_scatter", cse::NodeCategory::SHADER, "Subsurface Scattering", true, create_node_of_type<cse::SubsurfaceScatteringNode> },
+	{ cse::CyclesNodeType::Emission, "emission", cse::NodeCategory::SHADER, "Emission", true, create_node_of_type<cse::EmissionNode> },
+	{ cse::CyclesNodeType::HairBSDF, "hair_bsdf", cse::NodeCategory::SHADER, "Hair BSDF", true, create_node_of_type<cse::HairBSDFNode> },
+	{ cse::CyclesNodeType::Holdout, "holdout", cse::NodeCategory::SHADER, "Holdout", true, create_node_of_type<cse::HoldoutNode> },
+	{ cse::CyclesNodeType::VolAbsorption, "vol_absorb", cse::NodeCategory::SHADER, "Volume Absorption", true, create_node_of_type<cse::VolumeAbsorptionNode> },
+	{ cse::CyclesNodeType::VolScatter, "vol_scatter", cse::NodeCategory::SHADER, "Volume Scatter", true, create_node_of_type<cse::VolumeScatterNode> },
+	// Texture
+	{ cse::CyclesNodeType::MaxTex, "max_tex", cse::NodeCategory::TEXTURE, "3ds Max Texmap", MAX_TEX_IN_NODE_LIST, create_node_of_type<cse::MaxTexmapShaderNode> },
+	{ cse::CyclesNodeType::BrickTex, "brick_tex", cse::NodeCategory::TEXTURE, "Brick Texture", true, create_node_of_type<cse::BrickTextureNode> },
+	{ cse::CyclesNodeType::CheckerTex, "checker_tex", cse::NodeCategory::TEXTURE, "Checker Texture", true, create_node_of_type<cse::CheckerTextureNode> },
+	{ cse::CyclesNodeType::GradientTex, "gradient_tex", cse::NodeCategory::TEXTURE, "Gradient Texture", true, create_node_of_type<cse::GradientTextureNode> },
+	{ cse::CyclesNodeType::MagicTex, "magic_tex", cse::NodeCategory::TEXTURE, "Magic Texture", true, create_node_of_type<cse::MagicTextureNode> },
+	{ cse::CyclesNodeType::MusgraveTex, "musgrave_tex", cse::NodeCategory::TEXTURE, "Musgrave Texture", true, create_node_of_type<cse::MusgraveTextureNode> },
+	{ cse::CyclesNodeType::NoiseTex, "noise_tex", cse::NodeCategory::TEXTURE, "Noise Texture", true, create_node_of_type<cse::NoiseTextureNode> },
+	{ cse::CyclesNodeType::VoronoiTex, "voronoi_tex", cse::NodeCategory::TEXTURE, "Voronoi Texture", true, create_node_of_type<cse::VoronoiTextureNode> },
+	{ cse::CyclesNodeType::WaveTex, "wave_tex", cse::NodeCategory::TEXTURE, "Wave Texture", true, create_node_of_type<cse::WaveTextureNode> },
+	// Input
+	{ cse::CyclesNodeType::AmbientOcclusion, "ambient_occlusion", cse::NodeCategory::INPUT, "Ambient Occlusion", true, create_node_of_type<cse::AmbientOcculsionNode> },
+	{ cse::CyclesNodeType::Bevel, "bevel", cse::NodeCategory::INPUT, "Bevel", true, create_node_of_type<cse::BevelNode> },
+	{ cse::CyclesNodeType::CameraData, "camera_data", cse::NodeCategory::INPUT, "Camera Data", true, create_node_of_type<cse::CameraDataNode> },
+	{ cse::CyclesNodeType::Fresnel, "fresnel", cse::NodeCategory::INPUT, "Fresnel", true, create_node_of_type<cse::FresnelNode> },
+	{ cse::CyclesNodeType::Geometry, "geometry", cse::NodeCategory::INPUT, "Geometry", true, create_node_of_type<cse::GeometryNode> },
+	{ cse::CyclesNodeType::LayerWeight, "layer_weight", cse::NodeCategory::INPUT, "Layer Weight", true, create_node_of_type<cse::LayerWeightNode> },
+	{ cse::CyclesNodeType::LightPath, "light_path", cse::NodeCategory::INPUT, "Light Path", true, create_node_of_type<cse::LightPathNode> },
+	{ cse::CyclesNodeType::ObjectInfo, "object_info", cse::NodeCategory::INPUT, "Object Info", true, create_node_of_type<cse::ObjectInfoNode> },
+	{ cse::CyclesNodeType::RGB, "rgb", cse::NodeCategory::INPUT, "RGB", true, create_node_of_type<cse::RGBNode> },
+	{ cse::CyclesNodeType::Tangent, "tangent", cse::NodeCategory::INPUT, "Tangent", true, create_node_of_type<cse::TangentNode> },
+	{ cse::CyclesNodeType::TextureCoordinate, "texture_coordinate", cse::NodeCategory::INPUT, "Texture Coordinate", true, create_node_of_type<cse::TextureCoordinateNode> },
+	{ cse::CyclesNodeType::Value, "value", cse::NodeCategory::INPUT, "Value", true, create_node_of_type<cse::ValueNode> },
+	{ cse::CyclesNodeType::Wireframe, "wireframe", cse::NodeCategory::INPUT, "Wireframe", true, create_node_of_type<cse::WireframeNode> },
+	// Color
+	{ cse::CyclesNodeType::MixRGB, "mix_rgb", cse::NodeCategory::COLOR, "Mix RGB", true, create_node_of_type<cse::MixRGBNode> },
+	{ cse::CyclesNodeType::Invert, "invert", cse::NodeCategory::COLOR, "Invert", true, create_node_of_type<cse::InvertNode> },
+	{ cse::CyclesNodeType::LightFalloff, "light_falloff", cse::NodeCategory::COLOR, "Light Falloff", true, create_node_of_type<cse::LightFalloffNode> },
+	{ cse::CyclesNodeType::HSV, "hsv", cse::NodeCategory::COLOR, "HSV", true, create_node_of_type<cse::HSVNode> },
+	{ cse::CyclesNodeType::Gamma, "gamma", cse::NodeCategory::COLOR, "Gamma", true, create_node_of_type<cse::GammaNode> },
+	{ cse::CyclesNodeType::BrightnessContrast, "bright_contrast", cse::NodeCategory::COLOR, "Bright/Contrast", true, create_node_of_type<cse::BrightnessContrastNode> },
+	{ cse::CyclesNodeType::RGBCurves, "rgb_curves", cse::NodeCategory::COLOR, "RGB Curves", true, create_node_of_type<cse::RGBCurvesNode> },
+	// Vector
+	{ cse::CyclesNodeType::Bump, "bump", cse::NodeCategory::VECTOR, "Bump", true, create_node_of_type<cse::BumpNode> },
+	{ cse::CyclesNodeType::Displacement, "displacement", cse::NodeCategory::VECTOR, "Displacement", true, create_node_of_type<cse::DisplacementNode> },
+	{ cse::CyclesNodeType::NormalMap, "normal_map", cse::NodeCategory::VECTOR, "Normal Map", true, create_node_of_type<cse::NormalMapNode> },
+	{ cse::CyclesNodeType::VectorDisplacement, "vector_displacement", cse::NodeCategory::VECTOR, "Vector Displacement", true, create_node_of_type<cse::VectorDisplacementNode> },
+	{ cse::CyclesNodeType::VectorTransform, "vector_transform", cse::NodeCategory::VECTOR, "Vector Transform", true, create_node_of_type<cse::VectorTransformNode> },
+	// Converter
+	{ cse::CyclesNodeType::Blackbody, "blackbody", cse::NodeCategory::CONVERTER, "Blackbody", true, create_node_of_type<cse::BlackbodyNode> },
+	{ cse::CyclesNodeType::ColorRamp, "color_ramp", cse::NodeCategory::CONVERTER, "Color Ramp", true, create_node_of_type<cse::ColorRampNode> },
+	{ cse::CyclesNodeType::CombineHSV, "combine_hsv", cse::NodeCategory::CONVERTER, "Combine HSV", true, create_node_of_type<cse::CombineHSVNode> },
+	{ cse::CyclesNodeType::CombineRGB, "combine_rgb", cse::NodeCategory::CONVERTER, "Combine RGB", true, create_node_of_type<cse::CombineRGBNode> },
+	{ cse::CyclesNodeType::CombineXYZ, "combine_xyz", cse::NodeCategory::CONVERTER, "Combine XYZ", true, create_node_of_type<cse::CombineXYZNode> },
+	{ cse::CyclesNodeType::Math, "math", cse::NodeCategory::CONVERTER, "Math", true, create_node_of_type<cse::MathNode> },
+	{ cse::CyclesNodeType::RGBtoBW, "rgb_to_bw", cse::NodeCategory::CONVERTER, "RGB to BW", true, create_node_of_type<cse::RGBToBWNode> },
+	{ cse::CyclesNodeType::SeparateHSV, "separate_hsv", cse::NodeCategory::CONVERTER, "Separate HSV", true, create_node_of_type<cse::SeparateHSVNode> },
+	{ cse::CyclesNodeType::SeparateRGB, "separate_rgb", cse::NodeCategory::CONVERTER, "Separate RGB", true, create_node_of_type<cse::SeparateRGBNode> },
+	{ cse::CyclesNodeType::SeparateXYZ, "separate_xyz", cse::NodeCategory::CONVERTER, "Separate XYZ", true, create_node_of_type<cse::SeparateXYZNode> },
+	{ cse::CyclesNodeType::VectorMath, "vector_math", cse::NodeCategory::CONVERTER, "Vector Math", true, create_node_of_type<cse::VectorMathNode> },
+	{ cse::CyclesNodeType::Wavelength, "wavelength", cse::NodeCategory::CONVERTER, "Wavelength", true, create_node_of_type<cse::WavelengthNode> },
+	// Output
+	{ cse::CyclesNodeType::MaterialOutput, "out_material", cse::NodeCategory::OUTPUT, "Material Output", false, create_node_of_type<cse::MaterialOutputNode> },
+};
+
+static constexpr std::size_t NODE_TYPE_COUNT = sizeof(NODE_TYPES) / sizeof(NODE_TYPES[0]);
+
+// Type codes are looked up with a perfect hash: every code hashes to a different slot so a lookup is one hash and one string compare
+// If a new code collides with an existing one the static_assert below will fail, in that case CODE_HASH_SEED needs to be changed
+static constexpr std::uint32_t CODE_HASH_SEED = 19912;
+static constexpr std::size_t CODE_HASH_TABLE_SIZE = 256;
+
+static constexpr std::size_t hash_code(const char* code)
+{
+	// FNV-1a, using the top 8 bits because the low bits of FNV are poorly distributed
+	std::uint32_t hash = 2166136261u ^ CODE_HASH_SEED;
+	for (; *code != '\0'; code++) {
+		hash ^= static_cast<unsigned char>(*code);
+		hash *= 16777619u;
+	}
+	return static_cast<std::size_t>(hash >> 24);
+}
+
+class CodeHashTable {
+public:
+	// Index into NODE_TYPES plus one, zero marks an empty slot
+	unsigned char slots[CODE_HASH_TABLE_SIZE];
+};
+
+static constexpr CodeHashTable create_code_hash_table()
+{
+	CodeHashTable result = {};
+	for (std::size_t i = 0; i < NODE_TYPE_COUNT; i++) {
+		result.slots[hash_code(NODE_TYPES[i].code)] = static_cast<unsigned char>(i + 1);
+	}
+	return result;
+}
+
+static constexpr bool is_code_hash_perfect()
+{
+	bool used[CODE_HASH_TABLE_SIZE] = {};
+	for (std::size_t i = 0; i < NODE_TYPE_COUNT; i++) {
+		const std::size_t slot = hash_code(NODE_TYPES[i].code);
+		if (used[slot]) {
+			return false;
+		}
+		used[slot] = true;
+	}
+	return true;
+}
+
+static constexpr bool is_table_in_enum_order()
+{
+	for (std::size_t i = 0; i < NODE_TYPE_COUNT; i++) {
+		if (static_cast<std::size_t>(NODE_TYPES[i].type) != i) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static_assert(NODE_TYPE_COUNT == static_cast<std::size_t>(cse::CyclesNodeType::Unknown), "Every node type must be registered");
+static_assert(NODE_TYPE_COUNT < 256, "Node type indices must fit in a hash table slot");
+static_assert(is_table_in_enum_order(), "NODE_TYPES must be in the same order as CyclesNodeType");
+static_assert(is_code_hash_perfect(), "Node type codes collide in the hash table, CODE_HASH_SEED must be changed");
+
+static constexpr CodeHashTable CODE_HASH_TABLE = create_code_hash_table();
+
+std::size_t cse::get_node_type_count()
+{
+	return NODE_TYPE_COUNT;
+}
+
+const cse::NodeTypeInfo* cse::get_node_type_info(const CyclesNodeType type)
+{
+	const std::size_t index = static_cast<std::size_t>(type);
+	if (index >= NODE_TYPE_COUNT) {
+		return nullptr;
+	}
+	return &NODE_TYPES[index];
+}
+
+const cse::NodeTypeInfo* cse::get_node_type_info(const std::string& code)
+{
+	const unsigned char slot_value = CODE_HASH_TABLE.slots[hash_code(code.c_str())];
+	if (slot_value == 0) {
+		return nullptr;
+	}
+	const NodeTypeInfo* const result = &NODE_TYPES[slot_value - 1];
+	if (code != result->code) {
+		return nullptr;
+	}
+	return result;
+}
+
+std::shared_ptr<cse::EditableNode> cse::create_node(const CyclesNodeType type, const Float2 position)
+{
+	const NodeTypeInfo* const info = get_node_type_info(type);
+	if (info == nullptr) {
+		return nullptr;
+	}
+	return info->create(position);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "output.h"
+#include "util_enum.h"
+
+namespace cse {
+
+	class EditableNode;
+	class Float2;
+
+	// Static information about a node type
+	// One of these exists for every CyclesNodeType, stored in a constant table so lookups never allocate
+	class NodeTypeInfo {
+	public:
+		CyclesNodeType type;
+		// Identifier used for this type in serialized graphs
+		const char* code;
+		NodeCategory category;
+		const char* title;
+		// True if this node should be offered in the node creation list
+		bool in_node_list;
+		std::shared_ptr<EditableNode> (*create)(Float2 position);
+	};
+
+	// Number of registered types, this is the number of CyclesNodeType values before Unknown
+	std::size_t get_node_type_count();
+
+	// Both of these return nullptr if there is no registered type matching the input
+	const NodeTypeInfo* get_node_type_info(CyclesNodeType type);
+	const NodeTypeInfo* get_node_type_info(const std::string& code);
+
+	std::shared_ptr<EditableNode> create_node(CyclesNodeType type, Float2 position);
+
+}
@@ -8,605 +8,776 @@
 #include "util_enum.h"
 #include "util_vector.h"
 
-cse::PrincipledBSDFNode::PrincipledBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::PrincipledBSDF, "Principled BSDF")
-{
-	world_pos = position;
-
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
-
-	sockets.push_back(bsdf_output);
-
-	const auto dist_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
-	const auto dist_value = std::make_shared<StringEnumSocketValue>();
-	dist_value->enum_values.push_back(StringEnumPair("Multiscatter GGX", "multiscatter_ggx"));
-	dist_value->enum_values.push_back(StringEnumPair("GGX", "ggx"));
-	dist_value->set_from_internal_name("multiscatter_ggx");
-	dist_input->value = dist_value;
-	const auto base_color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Base Color", "base_color");
-	base_color_input->value = std::make_shared<ColorSocketValue>(0.8f, 0.8f, 0.8f);
-
-	const auto sss_method_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Subsurface Method", "subsurface_method");
-	const auto sss_method_value = std::make_shared<StringEnumSocketValue>();
-	sss_method_value->enum_values.push_back(StringEnumPair("Burley", "burley"));
-	sss_method_value->enum_values.push_back(StringEnumPair("Random Walk", "random_walk"));
-	sss_method_value->set_from_internal_name("burley");
-	sss_method_input->value = sss_method_value;
-	const auto ss_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Subsurface", "subsurface");
-	ss_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto ss_radius_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::VECTOR, "Subsurface Radius", "subsurface_radius");
-	ss_radius_input->value = std::make_shared<Float3SocketValue>(
+static cse::NodeSchema create_principled_bsdf_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::PrincipledBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+
+	schema.sockets.push_back(bsdf_output);
+
+	SocketDefinition dist_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
+	std::vector<StringEnumPair> dist_enum_values;
+	dist_enum_values.push_back(StringEnumPair("Multiscatter GGX", "multiscatter_ggx"));
+	dist_enum_values.push_back(StringEnumPair("GGX", "ggx"));
+	dist_input.default_value = std::make_shared<StringEnumSocketValue>(dist_enum_values, "multiscatter_ggx");
+	SocketDefinition base_color_input(SocketIOType::INPUT, SocketType::COLOR, "Base Color", "base_color");
+	base_color_input.default_value = std::make_shared<ColorSocketValue>(0.8f, 0.8f, 0.8f);
+
+	SocketDefinition sss_method_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Subsurface Method", "subsurface_method");
+	std::vector<StringEnumPair> sss_method_enum_values;
+	sss_method_enum_values.push_back(StringEnumPair("Burley", "burley"));
+	sss_method_enum_values.push_back(StringEnumPair("Random Walk", "random_walk"));
+	sss_method_input.default_value = std::make_shared<StringEnumSocketValue>(sss_method_enum_values, "burley");
+	SocketDefinition ss_input(SocketIOType::INPUT, SocketType::FLOAT, "Subsurface", "subsurface");
+	ss_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition ss_radius_input(SocketIOType::INPUT, SocketType::VECTOR, "Subsurface Radius", "subsurface_radius");
+	ss_radius_input.default_value = std::make_shared<Float3SocketValue>(
 		1.0f, 0.0f, 100.0f,
 		1.0f, 0.0f, 100.0f,
 		1.0f, 0.0f, 100.0f);
-	const auto ss_color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Subsurface Color", "subsurface_color");
-	ss_color_input->value = std::make_shared<ColorSocketValue>(0.7f, 0.1f, 0.1f);
-
-	const auto metallic_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Metallic", "metallic");
-	metallic_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto spec_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Specular", "specular");
-	spec_input->value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
-	const auto spec_tint_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Specular Tint", "specular_tint");
-	spec_tint_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
-	roughness_input->value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
-
-	const auto anisotropic_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Anisotropic", "anisotropic");
-	anisotropic_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto anisotropic_rot_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Rotation", "anisotropic_rotation");
-	anisotropic_rot_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-
-	const auto sheen_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Sheen", "sheen");
-	sheen_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto sheen_tint_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Sheen Tint", "sheen_tint");
-	sheen_tint_input->value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
-
-	const auto cc_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Clearcoat", "clearcoat");
-	cc_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto cc_roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Clearcoat Roughness", "clearcoat_roughness");
-	cc_roughness_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-
-	const auto ior_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "IOR", "ior");
-	ior_input->value = std::make_shared<FloatSocketValue>(1.45f, 0.0f, 100.0f);
-	const auto transmission_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Transmission", "transmission");
-	transmission_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-
-	const auto emission_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Emission", "emission");
-	emission_input->value = std::make_shared<ColorSocketValue>(0.0f, 0.0f, 0.0f);
-	const auto alpha_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Alpha", "alpha");
-	alpha_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
-
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
-	const auto cc_normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Clearcoat Normal", "clearcoat_normal");
-	const auto tangent_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::VECTOR, "Tangent", "tangent");
-
-	sockets.push_back(dist_input);
-	sockets.push_back(base_color_input);
-	sockets.push_back(sss_method_input);
-	sockets.push_back(ss_input);
-	sockets.push_back(ss_radius_input);
-	sockets.push_back(ss_color_input);
-	sockets.push_back(metallic_input);
-	sockets.push_back(spec_input);
-	sockets.push_back(spec_tint_input);
-	sockets.push_back(roughness_input);
-	sockets.push_back(anisotropic_input);
-	sockets.push_back(anisotropic_rot_input);
-	sockets.push_back(sheen_input);
-	sockets.push_back(sheen_tint_input);
-	sockets.push_back(cc_input);
-	sockets.push_back(cc_roughness_input);
-	sockets.push_back(ior_input);
-	sockets.push_back(transmission_input);
-	sockets.push_back(emission_input);
-	sockets.push_back(alpha_input);
-	sockets.push_back(normal_input);
-	sockets.push_back(cc_normal_input);
-	sockets.push_back(tangent_input);
-
-	content_width += 34.0f;
-}
-
-cse::PrincipledVolumeNode::PrincipledVolumeNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::PrincipledVolume, "Principled Volume")
-{
-	world_pos = position;
-
-	const auto volume_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "Volume", "volume");
-
-	sockets.push_back(volume_output);
-
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(0.5f, 0.5f, 0.5f);
-	const auto density_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Density", "density");
-	density_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 5000.0f);
-	const auto anisotropy_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Anisotropy", "anisotropy");
-	anisotropy_input->value = std::make_shared<FloatSocketValue>(0.0f, -1.0f, 1.0f);
-
-	const auto absorption_color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Absorption Color", "absorption_color");
-	absorption_color_input->value = std::make_shared<ColorSocketValue>(0.0f, 0.0f, 0.0f);
-	const auto emission_strength_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Emission Strength", "emission_strength");
-	emission_strength_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 5000.0f);
-	const auto emission_color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Emission Color", "emission_color");
-	emission_color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto blackbody_intensity_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Blackbody Intensity", "blackbody_intensity");
-	blackbody_intensity_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto blackbody_tint_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Blackbody Tint", "blackbody_tint");
-	blackbody_tint_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto temperature_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Temperature", "temperature");
-	temperature_input->value = std::make_shared<FloatSocketValue>(1500.0f, 0.0f, 5000.0f);
-
-	sockets.push_back(color_input);
-	sockets.push_back(density_input);
-	sockets.push_back(anisotropy_input);
-	sockets.push_back(absorption_color_input);
-	sockets.push_back(emission_strength_input);
-	sockets.push_back(emission_color_input);
-	sockets.push_back(blackbody_intensity_input);
-	sockets.push_back(blackbody_tint_input);
-	sockets.push_back(temperature_input);
-
-	content_width += 28.0f;
-}
-
-cse::PrincipledHairNode::PrincipledHairNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::PrincipledHair, "Principled Hair")
+	SocketDefinition ss_color_input(SocketIOType::INPUT, SocketType::COLOR, "Subsurface Color", "subsurface_color");
+	ss_color_input.default_value = std::make_shared<ColorSocketValue>(0.7f, 0.1f, 0.1f);
+
+	SocketDefinition metallic_input(SocketIOType::INPUT, SocketType::FLOAT, "Metallic", "metallic");
+	metallic_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition spec_input(SocketIOType::INPUT, SocketType::FLOAT, "Specular", "specular");
+	spec_input.default_value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
+	SocketDefinition spec_tint_input(SocketIOType::INPUT, SocketType::FLOAT, "Specular Tint", "specular_tint");
+	spec_tint_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
+	roughness_input.default_value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
+
+	SocketDefinition anisotropic_input(SocketIOType::INPUT, SocketType::FLOAT, "Anisotropic", "anisotropic");
+	anisotropic_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition anisotropic_rot_input(SocketIOType::INPUT, SocketType::FLOAT, "Rotation", "anisotropic_rotation");
+	anisotropic_rot_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+
+	SocketDefinition sheen_input(SocketIOType::INPUT, SocketType::FLOAT, "Sheen", "sheen");
+	sheen_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition sheen_tint_input(SocketIOType::INPUT, SocketType::FLOAT, "Sheen Tint", "sheen_tint");
+	sheen_tint_input.default_value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
+
+	SocketDefinition cc_input(SocketIOType::INPUT, SocketType::FLOAT, "Clearcoat", "clearcoat");
+	cc_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition cc_roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Clearcoat Roughness", "clearcoat_roughness");
+	cc_roughness_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+
+	SocketDefinition ior_input(SocketIOType::INPUT, SocketType::FLOAT, "IOR", "ior");
+	ior_input.default_value = std::make_shared<FloatSocketValue>(1.45f, 0.0f, 100.0f);
+	SocketDefinition transmission_input(SocketIOType::INPUT, SocketType::FLOAT, "Transmission", "transmission");
+	transmission_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+
+	SocketDefinition emission_input(SocketIOType::INPUT, SocketType::COLOR, "Emission", "emission");
+	emission_input.default_value = std::make_shared<ColorSocketValue>(0.0f, 0.0f, 0.0f);
+	SocketDefinition alpha_input(SocketIOType::INPUT, SocketType::FLOAT, "Alpha", "alpha");
+	alpha_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
+
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+	SocketDefinition cc_normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Clearcoat Normal", "clearcoat_normal");
+	SocketDefinition tangent_input(SocketIOType::INPUT, SocketType::VECTOR, "Tangent", "tangent");
+
+	schema.sockets.push_back(dist_input);
+	schema.sockets.push_back(base_color_input);
+	schema.sockets.push_back(sss_method_input);
+	schema.sockets.push_back(ss_input);
+	schema.sockets.push_back(ss_radius_input);
+	schema.sockets.push_back(ss_color_input);
+	schema.sockets.push_back(metallic_input);
+	schema.sockets.push_back(spec_input);
+	schema.sockets.push_back(spec_tint_input);
+	schema.sockets.push_back(roughness_input);
+	schema.sockets.push_back(anisotropic_input);
+	schema.sockets.push_back(anisotropic_rot_input);
+	schema.sockets.push_back(sheen_input);
+	schema.sockets.push_back(sheen_tint_input);
+	schema.sockets.push_back(cc_input);
+	schema.sockets.push_back(cc_roughness_input);
+	schema.sockets.push_back(ior_input);
+	schema.sockets.push_back(transmission_input);
+	schema.sockets.push_back(emission_input);
+	schema.sockets.push_back(alpha_input);
+	schema.sockets.push_back(normal_input);
+	schema.sockets.push_back(cc_normal_input);
+	schema.sockets.push_back(tangent_input);
+
+	schema.content_width += 34.0f;
+
+	return schema;
+}
+
+cse::PrincipledBSDFNode::PrincipledBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_principled_bsdf_schema>(), position)
+{
+
+}
+
+static cse::NodeSchema create_principled_volume_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::PrincipledVolume);
+
+	SocketDefinition volume_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "Volume", "volume");
+
+	schema.sockets.push_back(volume_output);
+
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(0.5f, 0.5f, 0.5f);
+	SocketDefinition density_input(SocketIOType::INPUT, SocketType::FLOAT, "Density", "density");
+	density_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 5000.0f);
+	SocketDefinition anisotropy_input(SocketIOType::INPUT, SocketType::FLOAT, "Anisotropy", "anisotropy");
+	anisotropy_input.default_value = std::make_shared<FloatSocketValue>(0.0f, -1.0f, 1.0f);
+
+	SocketDefinition absorption_color_input(SocketIOType::INPUT, SocketType::COLOR, "Absorption Color", "absorption_color");
+	absorption_color_input.default_value = std::make_shared<ColorSocketValue>(0.0f, 0.0f, 0.0f);
+	SocketDefinition emission_strength_input(SocketIOType::INPUT, SocketType::FLOAT, "Emission Strength", "emission_strength");
+	emission_strength_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 5000.0f);
+	SocketDefinition emission_color_input(SocketIOType::INPUT, SocketType::COLOR, "Emission Color", "emission_color");
+	emission_color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition blackbody_intensity_input(SocketIOType::INPUT, SocketType::FLOAT, "Blackbody Intensity", "blackbody_intensity");
+	blackbody_intensity_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition blackbody_tint_input(SocketIOType::INPUT, SocketType::COLOR, "Blackbody Tint", "blackbody_tint");
+	blackbody_tint_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition temperature_input(SocketIOType::INPUT, SocketType::FLOAT, "Temperature", "temperature");
+	temperature_input.default_value = std::make_shared<FloatSocketValue>(1500.0f, 0.0f, 5000.0f);
+
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(density_input);
+	schema.sockets.push_back(anisotropy_input);
+	schema.sockets.push_back(absorption_color_input);
+	schema.sockets.push_back(emission_strength_input);
+	schema.sockets.push_back(emission_color_input);
+	schema.sockets.push_back(blackbody_intensity_input);
+	schema.sockets.push_back(blackbody_tint_input);
+	schema.sockets.push_back(temperature_input);
+
+	schema.content_width += 28.0f;
+
+	return schema;
+}
+
+cse::PrincipledVolumeNode::PrincipledVolumeNode(const Float2 position) : EditableNode(get_static_schema<create_principled_volume_schema>(), position)
 {
+
+}
+
+static cse::NodeSchema create_principled_hair_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::PrincipledHair);
+
 	constexpr float PI = 3.14159f;
 
-	world_pos = position;
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
 
-	sockets.push_back(bsdf_output);
+	schema.sockets.push_back(bsdf_output);
 
-	const auto coloring_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Coloring", "coloring");
-	const auto coloring_value = std::make_shared<StringEnumSocketValue>();
-	coloring_value->enum_values.push_back(StringEnumPair("Absorption coefficient", "absorption_coefficient"));
-	coloring_value->enum_values.push_back(StringEnumPair("Melanin concentration", "melanin_concentration"));
-	coloring_value->enum_values.push_back(StringEnumPair("Direct coloring", "direct_coloring"));
-	coloring_value->set_from_internal_name("direct_coloring");
-	coloring_input->value = coloring_value;
+	SocketDefinition coloring_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Coloring", "coloring");
+	std::vector<StringEnumPair> coloring_enum_values;
+	coloring_enum_values.push_back(StringEnumPair("Absorption coefficient", "absorption_coefficient"));
+	coloring_enum_values.push_back(StringEnumPair("Melanin concentration", "melanin_concentration"));
+	coloring_enum_values.push_back(StringEnumPair("Direct coloring", "direct_coloring"));
+	coloring_input.default_value = std::make_shared<StringEnumSocketValue>(coloring_enum_values, "direct_coloring");
 
 	// Absorption coefficient
-	const auto absorption_coefficient_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::VECTOR, "Absorption Coefficient", "absorption_coefficient");
-	absorption_coefficient_input->value = std::make_shared<Float3SocketValue>(
+	SocketDefinition absorption_coefficient_input(SocketIOType::INPUT, SocketType::VECTOR, "Absorption Coefficient", "absorption_coefficient");
+	absorption_coefficient_input.default_value = std::make_shared<Float3SocketValue>(
 		0.245531f, 0.0f, 1000.0f,
 		0.52f,     0.0f, 1000.0f,
 		1.365f,    0.0f, 1000.0f);
-	absorption_coefficient_input->selectable = true;
+	absorption_coefficient_input.selectable = true;
 
 	// Melanin concentration
-	const auto melanin_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Melanin", "melanin");
-	melanin_input->value = std::make_shared<FloatSocketValue>(0.8f, 0.0f, 1.0f);
-	const auto melanin_redness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Melanin Redness", "melanin_redness");
-	melanin_redness_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
-	const auto tint_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Tint", "tint");
-	tint_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition melanin_input(SocketIOType::INPUT, SocketType::FLOAT, "Melanin", "melanin");
+	melanin_input.default_value = std::make_shared<FloatSocketValue>(0.8f, 0.0f, 1.0f);
+	SocketDefinition melanin_redness_input(SocketIOType::INPUT, SocketType::FLOAT, "Melanin Redness", "melanin_redness");
+	melanin_redness_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
+	SocketDefinition tint_input(SocketIOType::INPUT, SocketType::COLOR, "Tint", "tint");
+	tint_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
 
 	// Direct coloring
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(0.017513f, 0.005763f, 0.002059f);
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(0.017513f, 0.005763f, 0.002059f);
 
 	// General
-	const auto roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
-	roughness_input->value = std::make_shared<FloatSocketValue>(0.3f, 0.0f, 1.0f);
-	const auto radial_roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "radial_roughness");
-	radial_roughness_input->value = std::make_shared<FloatSocketValue>(0.3f, 0.0f, 1.0f);
-	const auto coat_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Coat", "coat");
-	coat_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto ior_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "IOR", "ior");
-	ior_input->value = std::make_shared<FloatSocketValue>(1.55f, 0.0f, 1000.0f);
-	const auto offset_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Offset", "offset");
-	offset_input->value = std::make_shared<FloatSocketValue>(2.0f * PI / 180.f, 0.0f, PI / 2.0f);
-	const auto random_roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Random Roughness", "random_roughness");
-	random_roughness_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto random_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Random", "random");
-	random_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1000.0f);
+	SocketDefinition roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
+	roughness_input.default_value = std::make_shared<FloatSocketValue>(0.3f, 0.0f, 1.0f);
+	SocketDefinition radial_roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "radial_roughness");
+	radial_roughness_input.default_value = std::make_shared<FloatSocketValue>(0.3f, 0.0f, 1.0f);
+	SocketDefinition coat_input(SocketIOType::INPUT, SocketType::FLOAT, "Coat", "coat");
+	coat_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition ior_input(SocketIOType::INPUT, SocketType::FLOAT, "IOR", "ior");
+	ior_input.default_value = std::make_shared<FloatSocketValue>(1.55f, 0.0f, 1000.0f);
+	SocketDefinition offset_input(SocketIOType::INPUT, SocketType::FLOAT, "Offset", "offset");
+	offset_input.default_value = std::make_shared<FloatSocketValue>(2.0f * PI / 180.f, 0.0f, PI / 2.0f);
+	SocketDefinition random_roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Random Roughness", "random_roughness");
+	random_roughness_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition random_input(SocketIOType::INPUT, SocketType::FLOAT, "Random", "random");
+	random_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1000.0f);
+
+	schema.sockets.push_back(coloring_input);
+	schema.sockets.push_back(absorption_coefficient_input);
+	schema.sockets.push_back(melanin_input);
+	schema.sockets.push_back(melanin_redness_input);
+	schema.sockets.push_back(tint_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(roughness_input);
+	schema.sockets.push_back(radial_roughness_input);
+	schema.sockets.push_back(coat_input);
+	schema.sockets.push_back(ior_input);
+	schema.sockets.push_back(offset_input);
+	schema.sockets.push_back(random_roughness_input);
+	schema.sockets.push_back(random_input);
+
+	schema.content_width += 62.0f;
+
+	return schema;
+}
 
-	sockets.push_back(coloring_input);
-	sockets.push_back(absorption_coefficient_input);
-	sockets.push_back(melanin_input);
-	sockets.push_back(melanin_redness_input);
-	sockets.push_back(tint_input);
-	sockets.push_back(color_input);
-	sockets.push_back(roughness_input);
-	sockets.push_back(radial_roughness_input);
-	sockets.push_back(coat_input);
-	sockets.push_back(ior_input);
-	sockets.push_back(offset_input);
-	sockets.push_back(random_roughness_input);
-	sockets.push_back(random_input);
+cse::PrincipledHairNode::PrincipledHairNode(const Float2 position) : EditableNode(get_static_schema<create_principled_hair_schema>(), position)
+{
 
-	content_width += 62.0f;
 }
 
-cse::MixShaderNode::MixShaderNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::MixShader, "Mix Shader")
+static cse::NodeSchema create_mix_shader_schema()
 {
-	world_pos = position;
+	using namespace cse;
 
-	const auto shader_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "Closure", "closure");
+	NodeSchema schema(CyclesNodeType::MixShader);
 
-	sockets.push_back(shader_output);
+	SocketDefinition shader_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "Closure", "closure");
 
-	const auto fac_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
-	fac_input->value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
-	const auto shader_a_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CLOSURE, "Closure1", "closure1");
-	const auto shader_b_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CLOSURE, "Closure2", "closure2");
+	schema.sockets.push_back(shader_output);
 
-	sockets.push_back(fac_input);
-	sockets.push_back(shader_a_input);
-	sockets.push_back(shader_b_input);
+	SocketDefinition fac_input(SocketIOType::INPUT, SocketType::FLOAT, "Fac", "fac");
+	fac_input.default_value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
+	SocketDefinition shader_a_input(SocketIOType::INPUT, SocketType::CLOSURE, "Closure1", "closure1");
+	SocketDefinition shader_b_input(SocketIOType::INPUT, SocketType::CLOSURE, "Closure2", "closure2");
+
+	schema.sockets.push_back(fac_input);
+	schema.sockets.push_back(shader_a_input);
+	schema.sockets.push_back(shader_b_input);
+
+	return schema;
 }
 
-cse::AddShaderNode::AddShaderNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::AddShader, "Add Shader")
+cse::MixShaderNode::MixShaderNode(const Float2 position) : EditableNode(get_static_schema<create_mix_shader_schema>(), position)
 {
-	world_pos = position;
 
-	const auto shader_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "Closure", "closure");
+}
 
-	sockets.push_back(shader_output);
+static cse::NodeSchema create_add_shader_schema()
+{
+	using namespace cse;
 
-	const auto shader_a_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CLOSURE, "Closure1", "closure1");
-	const auto shader_b_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::CLOSURE, "Closure2", "closure2");
+	NodeSchema schema(CyclesNodeType::AddShader);
 
-	sockets.push_back(shader_a_input);
-	sockets.push_back(shader_b_input);
-}
+	SocketDefinition shader_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "Closure", "closure");
 
-cse::DiffuseBSDFNode::DiffuseBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::DiffuseBSDF, "Diffuse BSDF")
-{
-	world_pos = position;
+	schema.sockets.push_back(shader_output);
+
+	SocketDefinition shader_a_input(SocketIOType::INPUT, SocketType::CLOSURE, "Closure1", "closure1");
+	SocketDefinition shader_b_input(SocketIOType::INPUT, SocketType::CLOSURE, "Closure2", "closure2");
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+	schema.sockets.push_back(shader_a_input);
+	schema.sockets.push_back(shader_b_input);
 
-	sockets.push_back(bsdf_output);
+	return schema;
+}
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
-	roughness_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+cse::AddShaderNode::AddShaderNode(const Float2 position) : EditableNode(get_static_schema<create_add_shader_schema>(), position)
+{
 
-	sockets.push_back(color_input);
-	sockets.push_back(roughness_input);
-	sockets.push_back(normal_input);
 }
 
-cse::GlossyBSDFNode::GlossyBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::GlossyBSDF, "Glossy BSDF")
+static cse::NodeSchema create_diffuse_bsdf_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::DiffuseBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+	schema.sockets.push_back(bsdf_output);
 
-	sockets.push_back(bsdf_output);
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
+	roughness_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
 
-	const auto dist_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
-	const auto dist_value = std::make_shared<StringEnumSocketValue>();
-	dist_value->enum_values.push_back(StringEnumPair("Ashikhmin-Shirley", "ashikhmin_shirley"));
-	dist_value->enum_values.push_back(StringEnumPair("Multiscatter GGX", "multiscatter_ggx"));
-	dist_value->enum_values.push_back(StringEnumPair("GGX", "ggx"));
-	dist_value->enum_values.push_back(StringEnumPair("Beckmann", "beckmann"));
-	dist_value->enum_values.push_back(StringEnumPair("Sharp", "sharp"));
-	dist_value->set_from_internal_name("ggx");
-	dist_input->value = dist_value;
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
-	roughness_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(roughness_input);
+	schema.sockets.push_back(normal_input);
 
-	sockets.push_back(dist_input);
-	sockets.push_back(color_input);
-	sockets.push_back(roughness_input);
-	sockets.push_back(normal_input);
+	return schema;
 }
 
-cse::TransparentBSDFNode::TransparentBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::TransparentBSDF, "Transparent BSDF")
+cse::DiffuseBSDFNode::DiffuseBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_diffuse_bsdf_schema>(), position)
 {
-	world_pos = position;
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+}
 
-	sockets.push_back(bsdf_output);
+static cse::NodeSchema create_glossy_bsdf_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::GlossyBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+
+	schema.sockets.push_back(bsdf_output);
+
+	SocketDefinition dist_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
+	std::vector<StringEnumPair> dist_enum_values;
+	dist_enum_values.push_back(StringEnumPair("Ashikhmin-Shirley", "ashikhmin_shirley"));
+	dist_enum_values.push_back(StringEnumPair("Multiscatter GGX", "multiscatter_ggx"));
+	dist_enum_values.push_back(StringEnumPair("GGX", "ggx"));
+	dist_enum_values.push_back(StringEnumPair("Beckmann", "beckmann"));
+	dist_enum_values.push_back(StringEnumPair("Sharp", "sharp"));
+	dist_input.default_value = std::make_shared<StringEnumSocketValue>(dist_enum_values, "ggx");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
+	roughness_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+
+	schema.sockets.push_back(dist_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(roughness_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
+}
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+cse::GlossyBSDFNode::GlossyBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_glossy_bsdf_schema>(), position)
+{
 
-	sockets.push_back(color_input);
 }
 
-
-cse::RefractionBSDFNode::RefractionBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::RefractionBSDF, "Refraction BSDF")
+static cse::NodeSchema create_transparent_bsdf_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::TransparentBSDF);
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
 
-	sockets.push_back(bsdf_output);
+	schema.sockets.push_back(bsdf_output);
 
-	const auto dist_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
-	const auto dist_value = std::make_shared<StringEnumSocketValue>();
-	dist_value->enum_values.push_back(StringEnumPair("GGX", "ggx"));
-	dist_value->enum_values.push_back(StringEnumPair("Beckmann", "beckmann"));
-	dist_value->enum_values.push_back(StringEnumPair("Sharp", "sharp"));
-	dist_value->set_from_internal_name("ggx");
-	dist_input->value = dist_value;
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
-	roughness_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto ior_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "IOR", "IOR");
-	ior_input->value = std::make_shared<FloatSocketValue>(1.45f, 0.0f, 100.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
 
-	sockets.push_back(dist_input);
-	sockets.push_back(color_input);
-	sockets.push_back(roughness_input);
-	sockets.push_back(ior_input);
-	sockets.push_back(normal_input);
+	schema.sockets.push_back(color_input);
+
+	return schema;
 }
 
-cse::GlassBSDFNode::GlassBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::GlassBSDF, "Glass BSDF")
+cse::TransparentBSDFNode::TransparentBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_transparent_bsdf_schema>(), position)
 {
-	world_pos = position;
-
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
 
-	sockets.push_back(bsdf_output);
+}
 
-	const auto dist_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
-	const auto dist_value = std::make_shared<StringEnumSocketValue>();
-	dist_value->enum_values.push_back(StringEnumPair("Multiscatter GGX", "multiscatter_ggx"));
-	dist_value->enum_values.push_back(StringEnumPair("GGX", "ggx"));
-	dist_value->enum_values.push_back(StringEnumPair("Beckmann", "beckmann"));
-	dist_value->enum_values.push_back(StringEnumPair("Sharp", "sharp"));
-	dist_value->set_from_internal_name("ggx");
-	dist_input->value = dist_value;
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
-	roughness_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto ior_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "IOR", "IOR");
-	ior_input->value = std::make_shared<FloatSocketValue>(1.45f, 0.0f, 100.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
 
-	sockets.push_back(dist_input);
-	sockets.push_back(color_input);
-	sockets.push_back(roughness_input);
-	sockets.push_back(ior_input);
-	sockets.push_back(normal_input);
+static cse::NodeSchema create_refraction_bsdf_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::RefractionBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+
+	schema.sockets.push_back(bsdf_output);
+
+	SocketDefinition dist_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
+	std::vector<StringEnumPair> dist_enum_values;
+	dist_enum_values.push_back(StringEnumPair("GGX", "ggx"));
+	dist_enum_values.push_back(StringEnumPair("Beckmann", "beckmann"));
+	dist_enum_values.push_back(StringEnumPair("Sharp", "sharp"));
+	dist_input.default_value = std::make_shared<StringEnumSocketValue>(dist_enum_values, "ggx");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
+	roughness_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition ior_input(SocketIOType::INPUT, SocketType::FLOAT, "IOR", "IOR");
+	ior_input.default_value = std::make_shared<FloatSocketValue>(1.45f, 0.0f, 100.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+
+	schema.sockets.push_back(dist_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(roughness_input);
+	schema.sockets.push_back(ior_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
 }
 
-cse::TranslucentBSDFNode::TranslucentBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::TranslucentBSDF, "Translucent BSDF")
+cse::RefractionBSDFNode::RefractionBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_refraction_bsdf_schema>(), position)
 {
-	world_pos = position;
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "bsdf");
+}
 
-	sockets.push_back(bsdf_output);
+static cse::NodeSchema create_glass_bsdf_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::GlassBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+
+	schema.sockets.push_back(bsdf_output);
+
+	SocketDefinition dist_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
+	std::vector<StringEnumPair> dist_enum_values;
+	dist_enum_values.push_back(StringEnumPair("Multiscatter GGX", "multiscatter_ggx"));
+	dist_enum_values.push_back(StringEnumPair("GGX", "ggx"));
+	dist_enum_values.push_back(StringEnumPair("Beckmann", "beckmann"));
+	dist_enum_values.push_back(StringEnumPair("Sharp", "sharp"));
+	dist_input.default_value = std::make_shared<StringEnumSocketValue>(dist_enum_values, "ggx");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
+	roughness_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition ior_input(SocketIOType::INPUT, SocketType::FLOAT, "IOR", "IOR");
+	ior_input.default_value = std::make_shared<FloatSocketValue>(1.45f, 0.0f, 100.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+
+	schema.sockets.push_back(dist_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(roughness_input);
+	schema.sockets.push_back(ior_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
+}
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+cse::GlassBSDFNode::GlassBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_glass_bsdf_schema>(), position)
+{
 
-	sockets.push_back(color_input);
-	sockets.push_back(normal_input);
 }
 
-cse::AnisotropicBSDFNode::AnisotropicBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::AnisotropicBSDF, "Anisotropic BSDF")
+static cse::NodeSchema create_translucent_bsdf_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::TranslucentBSDF);
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "bsdf");
 
-	sockets.push_back(bsdf_output);
+	schema.sockets.push_back(bsdf_output);
 
-	const auto dist_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
-	const auto dist_value = std::make_shared<StringEnumSocketValue>();
-	dist_value->enum_values.push_back(StringEnumPair("Ashikhmin-Shirley", "ashikhmin_shirley"));
-	dist_value->enum_values.push_back(StringEnumPair("Beckmann", "beckmann"));
-	dist_value->enum_values.push_back(StringEnumPair("Multiscatter GGX", "multiscatter_ggx"));
-	dist_value->enum_values.push_back(StringEnumPair("GGX", "ggx"));
-	dist_value->set_from_internal_name("ggx");
-	dist_input->value = dist_value;
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto roughness_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
-	roughness_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto aniso_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Anisotropy", "anisotropy");
-	aniso_input->value = std::make_shared<FloatSocketValue>(0.5f, -1.0f, 1.0f);
-	const auto rotation_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Rotation", "rotation");
-	rotation_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
-	const auto tangent_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::VECTOR, "Tangent", "tangent");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
 
-	sockets.push_back(dist_input);
-	sockets.push_back(color_input);
-	sockets.push_back(roughness_input);
-	sockets.push_back(aniso_input);
-	sockets.push_back(rotation_input);
-	sockets.push_back(normal_input);
-	sockets.push_back(tangent_input);
-}
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
+}
 
-cse::VelvetBSDFNode::VelvetBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::VelvetBSDF, "Velvet BSDF")
+cse::TranslucentBSDFNode::TranslucentBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_translucent_bsdf_schema>(), position)
 {
-	world_pos = position;
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+}
 
-	sockets.push_back(bsdf_output);
+static cse::NodeSchema create_anisotropic_bsdf_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::AnisotropicBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+
+	schema.sockets.push_back(bsdf_output);
+
+	SocketDefinition dist_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Distribution", "distribution");
+	std::vector<StringEnumPair> dist_enum_values;
+	dist_enum_values.push_back(StringEnumPair("Ashikhmin-Shirley", "ashikhmin_shirley"));
+	dist_enum_values.push_back(StringEnumPair("Beckmann", "beckmann"));
+	dist_enum_values.push_back(StringEnumPair("Multiscatter GGX", "multiscatter_ggx"));
+	dist_enum_values.push_back(StringEnumPair("GGX", "ggx"));
+	dist_input.default_value = std::make_shared<StringEnumSocketValue>(dist_enum_values, "ggx");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition roughness_input(SocketIOType::INPUT, SocketType::FLOAT, "Roughness", "roughness");
+	roughness_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition aniso_input(SocketIOType::INPUT, SocketType::FLOAT, "Anisotropy", "anisotropy");
+	aniso_input.default_value = std::make_shared<FloatSocketValue>(0.5f, -1.0f, 1.0f);
+	SocketDefinition rotation_input(SocketIOType::INPUT, SocketType::FLOAT, "Rotation", "rotation");
+	rotation_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+	SocketDefinition tangent_input(SocketIOType::INPUT, SocketType::VECTOR, "Tangent", "tangent");
+
+	schema.sockets.push_back(dist_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(roughness_input);
+	schema.sockets.push_back(aniso_input);
+	schema.sockets.push_back(rotation_input);
+	schema.sockets.push_back(normal_input);
+	schema.sockets.push_back(tangent_input);
+
+	return schema;
+}
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto sigma_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Sigma", "sigma");
-	sigma_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+cse::AnisotropicBSDFNode::AnisotropicBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_anisotropic_bsdf_schema>(), position)
+{
 
-	sockets.push_back(color_input);
-	sockets.push_back(sigma_input);
-	sockets.push_back(normal_input);
 }
 
-cse::ToonBSDFNode::ToonBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::ToonBSDF, "Toon BSDF")
+static cse::NodeSchema create_velvet_bsdf_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::VelvetBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+	schema.sockets.push_back(bsdf_output);
 
-	sockets.push_back(bsdf_output);
-
-	const auto comp_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Component", "component");
-	const auto comp_value = std::make_shared<StringEnumSocketValue>();
-	comp_value->enum_values.push_back(StringEnumPair("Diffuse", "diffuse"));
-	comp_value->enum_values.push_back(StringEnumPair("Glossy", "glossy"));
-	comp_value->set_from_internal_name("diffuse");
-	comp_input->value = comp_value;
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto size_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Size", "size");
-	size_input->value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
-	const auto smooth_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Smooth", "smooth");
-	smooth_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition sigma_input(SocketIOType::INPUT, SocketType::FLOAT, "Sigma", "sigma");
+	sigma_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
 
-	sockets.push_back(comp_input);
-	sockets.push_back(color_input);
-	sockets.push_back(size_input);
-	sockets.push_back(smooth_input);
-	sockets.push_back(normal_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(sigma_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
 }
 
-cse::SubsurfaceScatteringNode::SubsurfaceScatteringNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::SubsurfaceScattering, "Subsurface Scattering")
+cse::VelvetBSDFNode::VelvetBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_velvet_bsdf_schema>(), position)
 {
-	world_pos = position;
 
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSSRDF", "BSSRDF");
+}
+
+static cse::NodeSchema create_toon_bsdf_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::ToonBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+
+	schema.sockets.push_back(bsdf_output);
+
+	SocketDefinition comp_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Component", "component");
+	std::vector<StringEnumPair> comp_enum_values;
+	comp_enum_values.push_back(StringEnumPair("Diffuse", "diffuse"));
+	comp_enum_values.push_back(StringEnumPair("Glossy", "glossy"));
+	comp_input.default_value = std::make_shared<StringEnumSocketValue>(comp_enum_values, "diffuse");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition size_input(SocketIOType::INPUT, SocketType::FLOAT, "Size", "size");
+	size_input.default_value = std::make_shared<FloatSocketValue>(0.5f, 0.0f, 1.0f);
+	SocketDefinition smooth_input(SocketIOType::INPUT, SocketType::FLOAT, "Smooth", "smooth");
+	smooth_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+
+	schema.sockets.push_back(comp_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(size_input);
+	schema.sockets.push_back(smooth_input);
+	schema.sockets.push_back(normal_input);
+
+	return schema;
+}
 
-	sockets.push_back(bsdf_output);
+cse::ToonBSDFNode::ToonBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_toon_bsdf_schema>(), position)
+{
 
-	const auto comp_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Falloff", "falloff");
-	const auto comp_value = std::make_shared<StringEnumSocketValue>();
-	comp_value->enum_values.push_back(StringEnumPair("Christensen-Burley", "burley"));
-	comp_value->enum_values.push_back(StringEnumPair("Gaussian", "gaussian"));
-	comp_value->enum_values.push_back(StringEnumPair("Cubic", "cubic"));
-	comp_value->enum_values.push_back(StringEnumPair("Random Walk", "random_walk"));
-	comp_value->set_from_internal_name("burley");
-	comp_input->value = comp_value;
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto scale_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Scale", "scale");
-	scale_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1000.0f);
-	const auto radius_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::VECTOR, "Radius", "radius");
-	radius_input->value = std::make_shared<Float3SocketValue>(
+}
+
+static cse::NodeSchema create_subsurface_scattering_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::SubsurfaceScattering);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSSRDF", "BSSRDF");
+
+	schema.sockets.push_back(bsdf_output);
+
+	SocketDefinition comp_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Falloff", "falloff");
+	std::vector<StringEnumPair> comp_enum_values;
+	comp_enum_values.push_back(StringEnumPair("Christensen-Burley", "burley"));
+	comp_enum_values.push_back(StringEnumPair("Gaussian", "gaussian"));
+	comp_enum_values.push_back(StringEnumPair("Cubic", "cubic"));
+	comp_enum_values.push_back(StringEnumPair("Random Walk", "random_walk"));
+	comp_input.default_value = std::make_shared<StringEnumSocketValue>(comp_enum_values, "burley");
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition scale_input(SocketIOType::INPUT, SocketType::FLOAT, "Scale", "scale");
+	scale_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1000.0f);
+	SocketDefinition radius_input(SocketIOType::INPUT, SocketType::VECTOR, "Radius", "radius");
+	radius_input.default_value = std::make_shared<Float3SocketValue>(
 		1.0f, 0.0f, 100.0f,
 		1.0f, 0.0f, 100.0f,
 		1.0f, 0.0f, 100.0f);
-	radius_input->selectable = true;
-	const auto blur_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Texture Blur", "texture_blur");
-	blur_input->value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
-	const auto normal_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
+	radius_input.selectable = true;
+	SocketDefinition blur_input(SocketIOType::INPUT, SocketType::FLOAT, "Texture Blur", "texture_blur");
+	blur_input.default_value = std::make_shared<FloatSocketValue>(0.0f, 0.0f, 1.0f);
+	SocketDefinition normal_input(SocketIOType::INPUT, SocketType::NORMAL, "Normal", "normal");
 
-	sockets.push_back(comp_input);
-	sockets.push_back(color_input);
-	sockets.push_back(scale_input);
-	sockets.push_back(radius_input);
-	sockets.push_back(blur_input);
-	sockets.push_back(normal_input);
+	schema.sockets.push_back(comp_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(scale_input);
+	schema.sockets.push_back(radius_input);
+	schema.sockets.push_back(blur_input);
+	schema.sockets.push_back(normal_input);
 
-	content_width += 20.0f;
+	schema.content_width += 20.0f;
+
+	return schema;
 }
 
-cse::EmissionNode::EmissionNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::Emission, "Emission")
+cse::SubsurfaceScatteringNode::SubsurfaceScatteringNode(const Float2 position) : EditableNode(get_static_schema<create_subsurface_scattering_schema>(), position)
 {
-	world_pos = position;
 
-	const auto emission_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "Emission", "emission");
+}
 
-	sockets.push_back(emission_output);
+static cse::NodeSchema create_emission_schema()
+{
+	using namespace cse;
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto strength_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Strength", "strength");
-	strength_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 100000.0f);
+	NodeSchema schema(CyclesNodeType::Emission);
 
-	sockets.push_back(color_input);
-	sockets.push_back(strength_input);
+	SocketDefinition emission_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "Emission", "emission");
+
+	schema.sockets.push_back(emission_output);
+
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition strength_input(SocketIOType::INPUT, SocketType::FLOAT, "Strength", "strength");
+	strength_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 100000.0f);
+
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(strength_input);
+
+	return schema;
 }
 
-cse::HairBSDFNode::HairBSDFNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::HairBSDF, "Hair BSDF")
+cse::EmissionNode::EmissionNode(const Float2 position) : EditableNode(get_static_schema<create_emission_schema>(), position)
 {
-	world_pos = position;
-
-	const auto bsdf_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
 
-	sockets.push_back(bsdf_output);
+}
 
-	const auto comp_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::STRING_ENUM, "Component", "component");
-	const auto comp_value = std::make_shared<StringEnumSocketValue>();
-	comp_value->enum_values.push_back(StringEnumPair("Transmission", "transmission"));
-	comp_value->enum_values.push_back(StringEnumPair("Reflection", "reflection"));
-	comp_value->set_from_internal_name("reflection");
-	comp_input->value = comp_value;
+static cse::NodeSchema create_hair_bsdf_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::HairBSDF);
+
+	SocketDefinition bsdf_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "BSDF", "BSDF");
+
+	schema.sockets.push_back(bsdf_output);
+
+	SocketDefinition comp_input(SocketIOType::INPUT, SocketType::STRING_ENUM, "Component", "component");
+	std::vector<StringEnumPair> comp_enum_values;
+	comp_enum_values.push_back(StringEnumPair("Transmission", "transmission"));
+	comp_enum_values.push_back(StringEnumPair("Reflection", "reflection"));
+	comp_input.default_value = std::make_shared<StringEnumSocketValue>(comp_enum_values, "reflection");
+
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition offset_input(SocketIOType::INPUT, SocketType::FLOAT, "Offset", "offset");
+	offset_input.default_value = std::make_shared<FloatSocketValue>(0.0f, -90.0f, 90.0f);
+	SocketDefinition roughness_u_input(SocketIOType::INPUT, SocketType::FLOAT, "RoughnessU", "roughness_u");
+	roughness_u_input.default_value = std::make_shared<FloatSocketValue>(0.1f, 0.0f, 1.0f);
+	SocketDefinition roughness_v_input(SocketIOType::INPUT, SocketType::FLOAT, "RoughnessV", "roughness_v");
+	roughness_v_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
+	SocketDefinition tangent_input(SocketIOType::INPUT, SocketType::VECTOR, "Tangent", "tangent");
+
+	schema.sockets.push_back(comp_input);
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(offset_input);
+	schema.sockets.push_back(roughness_u_input);
+	schema.sockets.push_back(roughness_v_input);
+	schema.sockets.push_back(tangent_input);
+
+	return schema;
+}
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto offset_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Offset", "offset");
-	offset_input->value = std::make_shared<FloatSocketValue>(0.0f, -90.0f, 90.0f);
-	const auto roughness_u_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "RoughnessU", "roughness_u");
-	roughness_u_input->value = std::make_shared<FloatSocketValue>(0.1f, 0.0f, 1.0f);
-	const auto roughness_v_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "RoughnessV", "roughness_v");
-	roughness_v_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 1.0f);
-	const auto tangent_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::VECTOR, "Tangent", "tangent");
+cse::HairBSDFNode::HairBSDFNode(const Float2 position) : EditableNode(get_static_schema<create_hair_bsdf_schema>(), position)
+{
 
-	sockets.push_back(comp_input);
-	sockets.push_back(color_input);
-	sockets.push_back(offset_input);
-	sockets.push_back(roughness_u_input);
-	sockets.push_back(roughness_v_input);
-	sockets.push_back(tangent_input);
 }
 
-cse::HoldoutNode::HoldoutNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::Holdout, "Holdout")
+static cse::NodeSchema create_holdout_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::Holdout);
+
+	SocketDefinition holdout_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "Holdout", "holdout");
 
-	const auto holdout_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "Holdout", "holdout");
+	schema.sockets.push_back(holdout_output);
 
-	sockets.push_back(holdout_output);
+	return schema;
 }
 
-cse::VolumeAbsorptionNode::VolumeAbsorptionNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::VolAbsorption, "Volume Absorption")
+cse::HoldoutNode::HoldoutNode(const Float2 position) : EditableNode(get_static_schema<create_holdout_schema>(), position)
 {
-	world_pos = position;
 
-	const auto vol_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "Volume", "volume");
+}
+
+static cse::NodeSchema create_volume_absorption_schema()
+{
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::VolAbsorption);
+
+	SocketDefinition vol_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "Volume", "volume");
 
-	sockets.push_back(vol_output);
+	schema.sockets.push_back(vol_output);
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto density_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Density", "density");
-	density_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 100000.0f);
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition density_input(SocketIOType::INPUT, SocketType::FLOAT, "Density", "density");
+	density_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 100000.0f);
+
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(density_input);
+
+	return schema;
+}
+
+cse::VolumeAbsorptionNode::VolumeAbsorptionNode(const Float2 position) : EditableNode(get_static_schema<create_volume_absorption_schema>(), position)
+{
 
-	sockets.push_back(color_input);
-	sockets.push_back(density_input);
 }
 
-cse::VolumeScatterNode::VolumeScatterNode(const Float2 position) : EditableNode(NodeCategory::SHADER, CyclesNodeType::VolScatter, "Volume Scatter")
+static cse::NodeSchema create_volume_scatter_schema()
 {
-	world_pos = position;
+	using namespace cse;
+
+	NodeSchema schema(CyclesNodeType::VolScatter);
 
-	const auto vol_output = std::make_shared<NodeSocket>(this, SocketIOType::OUTPUT, SocketType::CLOSURE, "Volume", "volume");
+	SocketDefinition vol_output(SocketIOType::OUTPUT, SocketType::CLOSURE, "Volume", "volume");
 
-	sockets.push_back(vol_output);
+	schema.sockets.push_back(vol_output);
 
-	const auto color_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
-	color_input->value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
-	const auto density_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Density", "density");
-	density_input->value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 100000.0f);
-	const auto anisotropy_input = std::make_shared<NodeSocket>(this, SocketIOType::INPUT, SocketType::FLOAT, "Anisotropy", "anisotropy");
-	anisotropy_input->value = std::make_shared<FloatSocketValue>(0.0f, -1.0f, 1.0f);
+	SocketDefinition color_input(SocketIOType::INPUT, SocketType::COLOR, "Color", "color");
+	color_input.default_value = std::make_shared<ColorSocketValue>(1.0f, 1.0f, 1.0f);
+	SocketDefinition density_input(SocketIOType::INPUT, SocketType::FLOAT, "Density", "density");
+	density_input.default_value = std::make_shared<FloatSocketValue>(1.0f, 0.0f, 100000.0f);
+	SocketDefinition anisotropy_input(SocketIOType::INPUT, SocketType::FLOAT, "Anisotropy", "anisotropy");
+	anisotropy_input.default_value = std::make_shared<FloatSocketValue>(0.0f, -1.0f, 1.0f);
+
+	schema.sockets.push_back(color_input);
+	schema.sockets.push_back(density_input);
+	schema.sockets.push_back(anisotropy_input);
+
+	return schema;
+}
+
+cse::VolumeScatterNode::VolumeScatterNode(const Float2 position) : EditableNode(get_static_schema<create_volume_scatter_schema>(), position)
+{
 
-	sockets.push_back(color_input);
-	sockets.push_back(density_input);
-	sockets.push_back(anisotropy_input);
 }
@@ -6,15 +6,22 @@
 #include "drawing.h"
 #include "gui_sizes.h"
 #include "sockets.h"
+#include "util_color_batch.h"
 #include "util_enum.h"
 #include "util_vector.h"
 #include "wrapper_nvg_func.h"
 
+// The hue bar is drawn as multiple gradients, color pattern is R->Y->G->T->B->M->R
+static constexpr int HUE_BAR_SEGMENT_COUNT = 6;
+// hue_colors holds the color at the left edge of each segment followed by the brightest color at the current hue
+static constexpr int CURRENT_HUE_INDEX = HUE_BAR_SEGMENT_COUNT;
+
 cse::EditColorPanel::EditColorPanel(const float width) :
 	EditParamPanel(width),
 	color_rect_click_target(Float2(), Float2()),
 	hue_bar_click_target(Float2(), Float2()),
-	input_widget(width)
+	input_widget(width),
+	hue_colors(HUE_BAR_SEGMENT_COUNT + 1)
 {
 
 }
@@ -54,9 +61,13 @@ float cse::EditColorPanel::draw(NVGcontext* const draw_context)
 	}
 
 	// We need to know the color value as HSV to draw the ui
-	// Get RGB here, set sat and val to 1 to get the brightest color at this hue
-	const Float3 hsv_tmp(last_hue, 1.0f, 1.0f);
-	const Float3 hue_color = hsv_tmp.hsv_as_rgb();
+	// Get RGB here for every color the hue bar and color rectangle need, sat and val are set to 1 to get the brightest color at each hue
+	for (int i = 0; i < HUE_BAR_SEGMENT_COUNT; i++) {
+		hue_colors.set(i, Float3(static_cast<float>(i) / HUE_BAR_SEGMENT_COUNT, 1.0f, 1.0f));
+	}
+	hue_colors.set(CURRENT_HUE_INDEX, Float3(last_hue, 1.0f, 1.0f));
+	hsv_as_rgb(hue_colors, hue_colors);
+	const Float3 hue_color = hue_colors.get(CURRENT_HUE_INDEX);
 
 	// Add a little top margin
 	height_drawn += 6.0f;
@@ -100,8 +111,6 @@ float cse::EditColorPanel::draw(NVGcontext* const draw_context)
 
 	// Draw hue slider
 	{
-		// This is multiple gradients, color pattern is R->Y->G->T->B->M->R
-		const int HUE_BAR_SEGMENT_COUNT = 6;
 		const float hue_bar_width = panel_width - UI_SUBWIN_PARAM_EDIT_SLIDER_HPAD * 2;
 		const float hue_bar_height = UI_SUBWIN_PARAM_EDIT_LAYOUT_ROW_HEIGHT - UI_SUBWIN_PARAM_EDIT_SLIDER_VPAD * 2;
 		const float segment_width = hue_bar_width / HUE_BAR_SEGMENT_COUNT;
@@ -109,34 +118,8 @@ float cse::EditColorPanel::draw(NVGcontext* const draw_context)
 		const float draw_y = height_drawn + UI_SUBWIN_PARAM_EDIT_SLIDER_VPAD;
 		for (int i = 0; i < HUE_BAR_SEGMENT_COUNT; i++) {
 			const float segment_draw_x = draw_x + segment_width * i;
-			NVGcolor left_color = nvgRGBAf(0.0f, 0.0f, 0.0f, 1.0f);
-			NVGcolor right_color = nvgRGBAf(1.0f, 1.0f, 1.0f, 1.0f);
-			switch (i % HUE_BAR_SEGMENT_COUNT) {
-			case 0:
-				left_color = nvgRGBAf(1.0f, 0.0f, 0.0f, 1.0f);
-				right_color = nvgRGBAf(1.0f, 1.0f, 0.0f, 1.0f);
-				break;
-			case 1:
-				left_color = nvgRGBAf(1.0f, 1.0f, 0.0f, 1.0f);
-				right_color = nvgRGBAf(0.0f, 1.0f, 0.0f, 1.0f);
-				break;
-			case 2:
-				left_color = nvgRGBAf(0.0f, 1.0f, 0.0f, 1.0f);
-				right_color = nvgRGBAf(0.0f, 1.0f, 1.0f, 1.0f);
-				break;
-			case 3:
-				left_color = nvgRGBAf(0.0f, 1.0f, 1.0f, 1.0f);
-				right_color = nvgRGBAf(0.0f, 0.0f, 1.0f, 1.0f);
-				break;
-			case 4:
-				left_color = nvgRGBAf(0.0f, 0.0f, 1.0f, 1.0f);
-				right_color = nvgRGBAf(1.0f, 0.0f, 1.0f, 1.0f);
-				break;
-			case 5:
-				left_color = nvgRGBAf(1.0f, 0.0f, 1.0f, 1.0f);
-				right_color = nvgRGBAf(1.0f, 0.0f, 0.0f, 1.0f);
-				break;
-			}
+			const Float3 left_color = hue_colors.get(i);
+			const Float3 right_color = hue_colors.get((i + 1) % HUE_BAR_SEGMENT_COUNT);
 			NVGpaint segment_bg = nvgLinearGradient(draw_context, segment_draw_x, draw_y, segment_draw_x + segment_width, draw_y, left_color, right_color);
 			nvgBeginPath(draw_context);
 			nvgRect(draw_context, segment_draw_x, draw_y, segment_width, hue_bar_height);
@@ -4,6 +4,7 @@
 
 #include "panel_edit.h"
 #include "util_area.h"
+#include "util_color_batch.h"
 #include "widget_multi_input.h"
 
 struct NVGcontext;
@@ -57,5 +58,8 @@ namespace cse {
 		MultiInputWidget input_widget;
 
 		float last_hue = 0.0f;
+
+		// Converted from HSV in one batch each frame, see draw()
+		ColorBuffer hue_colors;
 	};
 }
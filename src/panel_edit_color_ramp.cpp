@@ -91,16 +91,17 @@ void cse::EditColorRampPanel::pre_draw()
 	);
 
 	// Copy values from internal types to the real socket
-	// FIXME: This doesn't need to happen every frame, may lead to bad performance in extreme cases
+	// The socket's revision only changes when a value was actually edited, which is what the preview checks
 	if (const auto ramp_socket_value = attached_ramp.lock()) {
-		ramp_socket_value->ramp_points.clear();
+		std::vector<ColorRampPoint> ramp_points;
+		ramp_points.reserve(ramp_rows.size());
 		for (const auto& this_row : ramp_rows) {
 			const float pos = this_row.value_pos->get_value();
 			const Float3 color = this_row.value_color->get_value();
 			const float alpha = this_row.value_alpha->get_value();
-			const ColorRampPoint new_point(pos, color, alpha);
-			ramp_socket_value->ramp_points.push_back(new_point);
+			ramp_points.push_back(ColorRampPoint(pos, color, alpha));
 		}
+		ramp_socket_value->set_ramp_points(ramp_points);
 	}
 
 	update_preview();
@@ -401,7 +402,7 @@ void cse::EditColorRampPanel::set_attached_value(const std::weak_ptr<SocketValue
 			if (attached_ramp.lock() != ramp_value_ptr) {
 				attached_ramp = ramp_value_ptr;
 				ramp_rows.clear();
-				for (const auto& this_point : ramp_value_ptr->ramp_points) {
+				for (const auto& this_point : ramp_value_ptr->get_ramp_points()) {
 					ramp_rows.push_back(this_point);
 				}
 			}
@@ -507,7 +508,13 @@ void cse::EditColorRampPanel::update_preview()
 	static_assert(PREVIEW_CHANNELS >= 4, "Expected at least 4 channels in preview texture");
 
 	if (const auto ramp = attached_ramp.lock()) {
-		const auto samples = ramp->evaluate_samples(PREVIEW_WIDTH_PX);
+		if (ramp->get_revision() == preview_revision) {
+			// The textures already show this ramp
+			return;
+		}
+		preview_revision = ramp->get_revision();
+
+		const std::vector<Float4>& samples = ramp->get_samples(PREVIEW_WIDTH_PX);
 		assert(samples.size() == PREVIEW_WIDTH_PX);
 
 		for (auto i = 0; i < PREVIEW_WIDTH_PX; i++) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -87,5 +88,7 @@ namespace cse {
 		NVGcontext* nvg_context = nullptr;
 		int nvg_handle_preview_color = -1;
 		int nvg_handle_preview_alpha = -1;
+		// Revision of the ramp the preview textures were last filled from, 0 if they have never been filled
+		std::uint64_t preview_revision = 0;
 	};
 }
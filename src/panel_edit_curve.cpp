@@ -1,5 +1,6 @@
 #include "panel_edit_curve.h"
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -10,6 +11,9 @@
 #include "gui_sizes.h"
 #include "sockets.h"
 
+// Number of line segments used to draw the evaluated curve
+static constexpr int CURVE_LINE_SEGMENTS = 128;
+
 static cse::Float2 get_panel_space_point(const cse::Float2 normalized_point, const float hpad, const float vpad, const float width, const float height)
 {
 	const float out_x = hpad + normalized_point.x * width;
@@ -133,22 +137,15 @@ float cse::EditCurvePanel::draw(NVGcontext* const draw_context)
 		nvgStroke(draw_context);
 
 		// Draw evaluated curve
+		update_curve_line(*attached_curve_ptr, rect_width, rect_height);
 		nvgBeginPath(draw_context);
-		{
-			constexpr int SEGMENTS = 128;
-			constexpr float UNITS_PER_SEGMENT = 1.0f / SEGMENTS;
-			const CurveEvaluator curve(attached_curve_ptr);
-			for (int i = 0; i <= SEGMENTS; i++) {
-				const float current_x = i * UNITS_PER_SEGMENT;
-				const float current_y = curve.eval(current_x);
-				const Float2 normalized_point(current_x, current_y);
-				const Float2 draw_point = get_panel_space_point(normalized_point, UI_SUBWIN_PARAM_EDIT_RECT_HPAD, UI_SUBWIN_PARAM_EDIT_RECT_VPAD, rect_width, rect_height);
-				if (i == 0) {
-					nvgMoveTo(draw_context, draw_point.x, draw_point.y);
-				}
-				else {
-					nvgLineTo(draw_context, draw_point.x, draw_point.y);
-				}
+		for (std::size_t i = 0; i < curve_line_points.size(); i++) {
+			const Float2 draw_point = curve_line_points[i];
+			if (i == 0) {
+				nvgMoveTo(draw_context, draw_point.x, draw_point.y);
+			}
+			else {
+				nvgLineTo(draw_context, draw_point.x, draw_point.y);
 			}
 		}
 		nvgStrokeWidth(draw_context, 1.0f);
@@ -157,7 +154,7 @@ float cse::EditCurvePanel::draw(NVGcontext* const draw_context)
 
 		// Draw points
 		nvgBeginPath(draw_context);
-		for (const Float2 this_point : attached_curve_ptr->curve_points) {
+		for (const Float2 this_point : attached_curve_ptr->get_curve_points()) {
 			const Float2 panel_space_point = get_panel_space_point(this_point, UI_SUBWIN_PARAM_EDIT_RECT_HPAD, UI_SUBWIN_PARAM_EDIT_RECT_VPAD, rect_width, rect_height);
 			nvgCircle(draw_context, panel_space_point.x, panel_space_point.y, UI_SUBWIN_PARAM_EDIT_CURVE_POINT_RADIUS);
 		}
@@ -166,7 +163,7 @@ float cse::EditCurvePanel::draw(NVGcontext* const draw_context)
 
 		// Draw selected point
 		if (selected_point_valid) {
-			const Float2 selected_point = attached_curve_ptr->curve_points[selected_point_index];
+			const Float2 selected_point = attached_curve_ptr->get_curve_points()[selected_point_index];
 			const Float2 selected_point_panel_space = get_panel_space_point(selected_point, UI_SUBWIN_PARAM_EDIT_RECT_HPAD, UI_SUBWIN_PARAM_EDIT_RECT_VPAD, rect_width, rect_height);
 			nvgBeginPath(draw_context);
 			nvgCircle(draw_context, selected_point_panel_space.x, selected_point_panel_space.y, UI_SUBWIN_PARAM_EDIT_CURVE_POINT_RADIUS * 1.5f);
@@ -305,10 +302,10 @@ float cse::EditCurvePanel::draw(NVGcontext* const draw_context)
 
 		// Mark for selected radio button
 		float selected_radio_pos_y = 0.0f;
-		if (attached_curve_ptr->curve_interp == CurveInterpolation::LINEAR) {
+		if (attached_curve_ptr->get_curve_interp() == CurveInterpolation::LINEAR) {
 			selected_radio_pos_y = radio_linear_pos_y;
 		}
-		else if (attached_curve_ptr->curve_interp == CurveInterpolation::CUBIC_HERMITE) {
+		else if (attached_curve_ptr->get_curve_interp() == CurveInterpolation::CUBIC_HERMITE) {
 			selected_radio_pos_y = radio_hermite_pos_y;
 		}
 		nvgBeginPath(draw_context);
@@ -392,8 +389,8 @@ void cse::EditCurvePanel::handle_mouse_button(int button, int action, int /*mods
 			if (this_area.contains_point(mouse_local_pos)) {
 				if (attached_curve_ptr) {
 					const CurveInterpolation new_interp = this_area.get_value();
-					if (attached_curve_ptr->curve_interp != new_interp) {
-						attached_curve_ptr->curve_interp = new_interp;
+					if (attached_curve_ptr->get_curve_interp() != new_interp) {
+						attached_curve_ptr->set_curve_interp(new_interp);
 						request_undo_push = true;
 					}
 				}
@@ -439,3 +436,65 @@ void cse::EditCurvePanel::move_selected_point(const Float2 new_pos)
 		}
 	}
 }
+
+void cse::EditCurvePanel::update_curve_line(const CurveSocketValue& curve, const float rect_width, const float rect_height)
+{
+	constexpr float UNITS_PER_SEGMENT = 1.0f / CURVE_LINE_SEGMENTS;
+
+	const bool revision_changed = curve.get_revision() != curve_line_revision;
+	if (revision_changed) {
+		const std::vector<Float2>& curve_points = curve.get_curve_points();
+		const CurveInterpolation curve_interp = curve.get_curve_interp();
+
+		// When the only change is points moving, as happens during a drag, only the segments using those points need to be evaluated again
+		// Linear curves are cheap enough that they are always fully evaluated
+		const bool points_moved =
+			curve_line_y.size() == CURVE_LINE_SEGMENTS + 1 &&
+			curve_interp == CurveInterpolation::CUBIC_HERMITE &&
+			curve_interp == curve_line_interp &&
+			curve_points.size() >= 2 &&
+			curve_points.size() == curve_line_control_points.size();
+
+		if (points_moved) {
+			std::size_t first_changed = curve_points.size();
+			std::size_t last_changed = 0;
+			for (std::size_t i = 0; i < curve_points.size(); i++) {
+				if (curve_points[i] != curve_line_control_points[i]) {
+					first_changed = std::min(first_changed, i);
+					last_changed = i;
+				}
+			}
+
+			if (first_changed < curve_points.size()) {
+				// Each hermite segment uses the two points on either side of it, so a point affects the curve up to two points away
+				const float begin_x = first_changed >= 2 ? curve_points[first_changed - 2].x : 0.0f;
+				const float end_x = last_changed + 2 < curve_points.size() ? curve_points[last_changed + 2].x : 1.0f;
+				const CurveEvaluator evaluator(&curve, begin_x, end_x, CURVE_LINE_SEGMENTS);
+				const std::vector<float>& samples = evaluator.get_samples();
+				for (int i = 0; i <= CURVE_LINE_SEGMENTS; i++) {
+					const float current_x = i * UNITS_PER_SEGMENT;
+					if (current_x >= begin_x && current_x <= end_x) {
+						curve_line_y[i] = samples[i];
+					}
+				}
+			}
+		}
+		else {
+			const CurveEvaluator evaluator(&curve, CURVE_LINE_SEGMENTS);
+			curve_line_y = evaluator.get_samples();
+		}
+
+		curve_line_control_points = curve_points;
+		curve_line_interp = curve_interp;
+		curve_line_revision = curve.get_revision();
+	}
+
+	if (revision_changed || rect_width != curve_line_width) {
+		curve_line_points.clear();
+		for (int i = 0; i <= CURVE_LINE_SEGMENTS; i++) {
+			const Float2 normalized_point(i * UNITS_PER_SEGMENT, curve_line_y[i]);
+			curve_line_points.push_back(get_panel_space_point(normalized_point, UI_SUBWIN_PARAM_EDIT_RECT_HPAD, UI_SUBWIN_PARAM_EDIT_RECT_VPAD, rect_width, rect_height));
+		}
+		curve_line_width = rect_width;
+	}
+}
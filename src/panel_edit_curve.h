@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -32,6 +33,8 @@ namespace cse {
 
 	private:
 		void move_selected_point(Float2 new_pos);
+		// Evaluates the curve again only if it or the panel width changed since the last call
+		void update_curve_line(const CurveSocketValue& curve, float rect_width, float rect_height);
 
 		std::weak_ptr<CurveSocketValue> attached_curve;
 		EditCurveMode edit_mode = EditCurveMode::MOVE;
@@ -46,5 +49,14 @@ namespace cse {
 		bool moving_selected_point = false;
 		bool mouse_has_moved = false;
 		Float2 move_selected_point_begin_mouse_pos;
+
+		// Evaluated curve, the y values are normalized and the points are in panel space
+		std::vector<float> curve_line_y;
+		std::vector<Float2> curve_line_points;
+		// Curve that curve_line_y was evaluated from, used to find which points moved
+		std::vector<Float2> curve_line_control_points;
+		CurveInterpolation curve_line_interp = CurveInterpolation::CUBIC_HERMITE;
+		std::uint64_t curve_line_revision = 0;
+		float curve_line_width = 0.0f;
 	};
 }
@@ -3,10 +3,10 @@
 #include "node_base.h"
 #include "util_vector.h"
 
-void cse::Selection::move_nodes(const Float2 delta)
+void cse::Selection::move_nodes(const std::list<std::shared_ptr<EditableNode>>& graph_nodes, const Float2 delta)
 {
-	for (const auto weak_node : nodes) {
-		if (const auto this_node = weak_node.lock()) {
+	for (const auto& this_node : graph_nodes) {
+		if (this_node->selected) {
 			this_node->world_pos += delta;
 		}
 	}
@@ -26,23 +26,56 @@ void cse::Selection::modify_selection(SelectMode mode, std::weak_ptr<EditableNod
 			}
 			else {
 				// This node is not selected, now select this node exclusively
-				nodes.clear();
-				nodes.insert(node);
+				clear_nodes();
+				add_node(node);
 			}
 			break;
 		}
 		case SelectMode::ADD:
 		{
-			nodes.insert(node);
+			add_node(node);
 			break;
 		}
 		case SelectMode::TOGGLE:
 		{
 			if (nodes.count(node) > 0) {
-				nodes.erase(node);
+				remove_node(node);
 			}
 			else {
-				nodes.insert(node);
+				add_node(node);
+			}
+			break;
+		}
+	}
+}
+
+void cse::Selection::modify_selection(const SelectMode mode, const WeakNodeSet& nodes_in)
+{
+	switch (mode) {
+		case SelectMode::NORMAL:
+		{
+			clear_nodes();
+			for (const auto& this_node : nodes_in) {
+				add_node(this_node);
+			}
+			break;
+		}
+		case SelectMode::ADD:
+		{
+			for (const auto& this_node : nodes_in) {
+				add_node(this_node);
+			}
+			break;
+		}
+		case SelectMode::TOGGLE:
+		{
+			for (const auto& this_node : nodes_in) {
+				if (nodes.count(this_node) > 0) {
+					remove_node(this_node);
+				}
+				else {
+					add_node(this_node);
+				}
 			}
 			break;
 		}
@@ -51,6 +84,37 @@ void cse::Selection::modify_selection(SelectMode mode, std::weak_ptr<EditableNod
 
 void cse::Selection::clear()
 {
-	nodes.clear();
+	clear_nodes();
 	socket = std::weak_ptr<NodeSocket>();
-}
\ No newline at end of file
+}
+
+void cse::Selection::clear_nodes()
+{
+	for (const auto& weak_node : nodes) {
+		if (const auto this_node = weak_node.lock()) {
+			this_node->selected = false;
+		}
+	}
+	nodes.clear();
+}
+
+const cse::WeakNodeSet& cse::Selection::get_nodes() const
+{
+	return nodes;
+}
+
+void cse::Selection::add_node(const std::weak_ptr<EditableNode>& node)
+{
+	if (const auto this_node = node.lock()) {
+		this_node->selected = true;
+		nodes.insert(node);
+	}
+}
+
+void cse::Selection::remove_node(const std::weak_ptr<EditableNode>& node)
+{
+	if (const auto this_node = node.lock()) {
+		this_node->selected = false;
+	}
+	nodes.erase(node);
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <list>
 #include <memory>
 
 #include "util_typedef.h"
@@ -17,15 +18,26 @@ namespace cse {
 	};
 
 	// This class is used to hold references to the objects currently selected by the user
+	// Each selected node also has its 'selected' flag set so per-frame code can check selection without searching the set
 	class Selection {
 	public:
-		void move_nodes(Float2 delta);
+		// Moves every selected node in graph_nodes, this only checks each node's flag so no weak_ptrs need to be locked
+		void move_nodes(const std::list<std::shared_ptr<EditableNode>>& graph_nodes, Float2 delta);
 
 		void modify_selection(SelectMode mode, std::weak_ptr<EditableNode> node);
+		void modify_selection(SelectMode mode, const WeakNodeSet& nodes_in);
 
 		void clear();
+		void clear_nodes();
+
+		const WeakNodeSet& get_nodes() const;
 
-		WeakNodeSet nodes;
 		std::weak_ptr<NodeSocket> socket;
+
+	private:
+		void add_node(const std::weak_ptr<EditableNode>& node);
+		void remove_node(const std::weak_ptr<EditableNode>& node);
+
+		WeakNodeSet nodes;
 	};
 }
@@ -1,22 +1,15 @@
 #include "serialize.h"
 
-#include <cassert>
 #include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "node_base.h"
-#include "node_colors.h"
-#include "node_converter.h"
-#include "node_inputs.h"
-#include "node_interop_max.h"
-#include "node_outputs.h"
-#include "node_shaders.h"
-#include "node_textures.h"
-#include "node_vector.h"
+#include "node_registry.h"
 #include "output.h"
 #include "sockets.h"
 #include "util_color_ramp.h"
@@ -34,104 +27,11 @@ static const char* SECTION_LABEL_CONNECTION = "section_connections";
 
 static const char* NODE_END = "node_end";
 
-std::map<cse::CyclesNodeType, std::string> type_to_code;
-std::map<std::string, cse::CyclesNodeType> code_to_type;
-
 static std::string create_node_name(const std::size_t number)
 {
 	return std::string("node") + std::to_string(number);
 }
 
-static void initialize_maps()
-{
-	using namespace cse;
-
-	if (!type_to_code.empty()) {
-		// Map is already inialized
-		return;
-	}
-
-	type_to_code[CyclesNodeType::PrincipledBSDF] = std::string("principled_bsdf");
-	type_to_code[CyclesNodeType::PrincipledVolume] = std::string("principled_volume");
-	type_to_code[CyclesNodeType::PrincipledHair] = std::string("principled_hair");
-	type_to_code[CyclesNodeType::MixShader] = std::string("mix_shader");
-	type_to_code[CyclesNodeType::AddShader] = std::string("add_shader");
-	type_to_code[CyclesNodeType::DiffuseBSDF] = std::string("diffuse_bsdf");
-	type_to_code[CyclesNodeType::GlossyBSDF] = std::string("glossy_bsdf");
-	type_to_code[CyclesNodeType::TransparentBSDF] = std::string("transparent_bsdf");
-	type_to_code[CyclesNodeType::RefractionBSDF] = std::string("refraction_bsdf");
-	type_to_code[CyclesNodeType::GlassBSDF] = std::string("glass_bsdf");
-	type_to_code[CyclesNodeType::TranslucentBSDF] = std::string("translucent_bsdf");
-	type_to_code[CyclesNodeType::AnisotropicBSDF] = std::string("anisotropic_bsdf");
-	type_to_code[CyclesNodeType::VelvetBSDF] = std::string("velvet_bsdf");
-	type_to_code[CyclesNodeType::ToonBSDF] = std::string("toon_bsdf");
-	type_to_code[CyclesNodeType::SubsurfaceScattering] = std::string("subsurface_scatter");
-	type_to_code[CyclesNodeType::Emission] = std::string("emission");
-	type_to_code[CyclesNodeType::HairBSDF] = std::string("hair_bsdf");
-	type_to_code[CyclesNodeType::Holdout] = std::string("holdout");
-	type_to_code[CyclesNodeType::VolAbsorption] = std::string("vol_absorb");
-	type_to_code[CyclesNodeType::VolScatter] = std::string("vol_scatter");
-
-	type_to_code[CyclesNodeType::MaxTex] = std::string("max_tex");
-	type_to_code[CyclesNodeType::BrickTex] = std::string("brick_tex");
-	type_to_code[CyclesNodeType::CheckerTex] = std::string("checker_tex");
-	type_to_code[CyclesNodeType::GradientTex] = std::string("gradient_tex");
-	type_to_code[CyclesNodeType::MagicTex] = std::string("magic_tex");
-	type_to_code[CyclesNodeType::MusgraveTex] = std::string("musgrave_tex");
-	type_to_code[CyclesNodeType::NoiseTex] = std::string("noise_tex");
-	type_to_code[CyclesNodeType::VoronoiTex] = std::string("voronoi_tex");
-	type_to_code[CyclesNodeType::WaveTex] = std::string("wave_tex");
-
-	type_to_code[CyclesNodeType::AmbientOcclusion] = std::string("ambient_occlusion");
-	type_to_code[CyclesNodeType::Bevel] = std::string("bevel");
-	type_to_code[CyclesNodeType::LightPath] = std::string("light_path");
-	type_to_code[CyclesNodeType::Fresnel] = std::string("fresnel");
-	type_to_code[CyclesNodeType::LayerWeight] = std::string("layer_weight");
-	type_to_code[CyclesNodeType::CameraData] = std::string("camera_data");
-	type_to_code[CyclesNodeType::Tangent] = std::string("tangent");
-	type_to_code[CyclesNodeType::TextureCoordinate] = std::string("texture_coordinate");
-	type_to_code[CyclesNodeType::Geometry] = std::string("geometry");
-	type_to_code[CyclesNodeType::ObjectInfo] = std::string("object_info");
-	type_to_code[CyclesNodeType::RGB] = std::string("rgb");
-	type_to_code[CyclesNodeType::Value] = std::string("value");
-	type_to_code[CyclesNodeType::Wireframe] = std::string("wireframe");
-
-	type_to_code[CyclesNodeType::MixRGB] = std::string("mix_rgb");
-	type_to_code[CyclesNodeType::Invert] = std::string("invert");
-	type_to_code[CyclesNodeType::LightFalloff] = std::string("light_falloff");
-	type_to_code[CyclesNodeType::HSV] = std::string("hsv");
-	type_to_code[CyclesNodeType::Gamma] = std::string("gamma");
-	type_to_code[CyclesNodeType::BrightnessContrast] = std::string("bright_contrast");
-	type_to_code[CyclesNodeType::RGBCurves] = std::string("rgb_curves");
-
-	type_to_code[CyclesNodeType::Bump] = std::string("bump");
-	type_to_code[CyclesNodeType::Displacement] = std::string("displacement");
-	type_to_code[CyclesNodeType::NormalMap] = std::string("normal_map");
-	type_to_code[CyclesNodeType::VectorDisplacement] = std::string("vector_displacement");
-	type_to_code[CyclesNodeType::VectorTransform] = std::string("vector_transform");
-
-	type_to_code[CyclesNodeType::Blackbody] = std::string("blackbody");
-	type_to_code[CyclesNodeType::ColorRamp] = std::string("color_ramp");
-	type_to_code[CyclesNodeType::CombineHSV] = std::string("combine_hsv");
-	type_to_code[CyclesNodeType::CombineRGB] = std::string("combine_rgb");
-	type_to_code[CyclesNodeType::CombineXYZ] = std::string("combine_xyz");
-	type_to_code[CyclesNodeType::Math] = std::string("math");
-	type_to_code[CyclesNodeType::RGBtoBW] = std::string("rgb_to_bw");
-	type_to_code[CyclesNodeType::SeparateHSV] = std::string("separate_hsv");
-	type_to_code[CyclesNodeType::SeparateRGB] = std::string("separate_rgb");
-	type_to_code[CyclesNodeType::SeparateXYZ] = std::string("separate_xyz");
-	type_to_code[CyclesNodeType::VectorMath] = std::string("vector_math");
-	type_to_code[CyclesNodeType::Wavelength] = std::string("wavelength");
-
-	type_to_code[CyclesNodeType::MaterialOutput] = std::string("out_material");
-
-	for (std::pair<CyclesNodeType, std::string> this_pair : type_to_code) {
-		code_to_type[this_pair.second] = this_pair.first;
-	}
-
-	assert(code_to_type.size() == type_to_code.size());
-}
-
 static std::list<std::string> tokenize_string(const std::string& input, const char delim)
 {
 	std::list<std::string> output;
@@ -199,20 +99,20 @@ static void deserialize_curve(const std::string serialized_curve, const std::sha
 		return;
 	}
 
-	curve_value->curve_points.clear();
+	std::vector<cse::Float2> curve_points;
 	for (std::size_t points_copied = 0; points_copied < control_point_count; points_copied++) {
 		const float x = cse::locale_safe_stof(*(input_iter++));
 		const float y = cse::locale_safe_stof(*(input_iter++));
 		cse::Float2 this_point(x, y);
-		curve_value->curve_points.push_back(this_point);
+		curve_points.push_back(this_point);
 	}
-	curve_value->sort_curve_points();
+	curve_value->set_curve_points(curve_points);
 
 	if (interpolation_str == "cubic_hermite") {
-		curve_value->curve_interp = cse::CurveInterpolation::CUBIC_HERMITE;
+		curve_value->set_curve_interp(cse::CurveInterpolation::CUBIC_HERMITE);
 	}
 	else {
-		curve_value->curve_interp = cse::CurveInterpolation::LINEAR;
+		curve_value->set_curve_interp(cse::CurveInterpolation::LINEAR);
 	}
 }
 
@@ -250,7 +150,7 @@ static void deserialize_color_ramp(const std::string serialized_ramp, const std:
 		return;
 	}
 
-	ramp_value->ramp_points.clear();
+	std::vector<cse::ColorRampPoint> ramp_points;
 	const size_t iterations = (tokenized_input.size() - 1) / 5;
 	for (size_t i = 0; i < iterations; i++) {
 		const float pos = cse::locale_safe_stof(*(input_iter++));
@@ -259,21 +159,23 @@ static void deserialize_color_ramp(const std::string serialized_ramp, const std:
 		const float b = cse::locale_safe_stof(*(input_iter++));
 		const float alpha = cse::locale_safe_stof(*(input_iter++));
 		cse::ColorRampPoint point(pos, cse::Float3(r, g, b), alpha);
-		ramp_value->ramp_points.push_back(point);
+		ramp_points.push_back(point);
 	}
+	ramp_value->set_ramp_points(ramp_points);
 }
 
 static std::string serialize_node(const cse::OutputNode& node)
 {
 	using namespace cse;
 
-	if (type_to_code.count(node.type) == 0) {
+	const NodeTypeInfo* const type_info = get_node_type_info(node.type);
+	if (type_info == nullptr) {
 		return std::string();
 	}
 
 	std::stringstream node_stream;
 
-	node_stream << type_to_code[node.type] << SEPARATOR << node.name << SEPARATOR << node.world_x << SEPARATOR << node.world_y << SEPARATOR;
+	node_stream << type_info->code << SEPARATOR << node.name << SEPARATOR << node.world_x << SEPARATOR << node.world_y << SEPARATOR;
 
 	for (std::pair<std::string, float> this_pair : node.float_values) {
 		node_stream << this_pair.first << SEPARATOR << this_pair.second << SEPARATOR;
@@ -347,8 +249,6 @@ void cse::generate_output_lists(
 
 std::string cse::serialize_graph(std::vector<OutputNode> &nodes, std::vector<OutputConnection> &connections)
 {
-	initialize_maps();
-
 	std::stringstream output_stream;
 
 	// Write first entry
@@ -369,294 +269,10 @@ std::string cse::serialize_graph(std::vector<OutputNode> &nodes, std::vector<Out
 	return output_stream.str();
 }
 
-static std::shared_ptr<cse::EditableNode> create_node_from_type(cse::CyclesNodeType type) {
-	using namespace cse;
-	const Float2 pos(0.0f, 0.0f);
-	switch (type) {
-		case CyclesNodeType::PrincipledBSDF:
-		{
-			return std::make_shared<PrincipledBSDFNode>(pos);
-		}
-		case CyclesNodeType::PrincipledVolume:
-		{
-			return std::make_shared<PrincipledVolumeNode>(pos);
-		}
-		case CyclesNodeType::PrincipledHair:
-		{
-			return std::make_shared<PrincipledHairNode>(pos);
-		}
-		case CyclesNodeType::MixShader:
-		{
-			return std::make_shared<MixShaderNode>(pos);
-		}
-		case CyclesNodeType::AddShader:
-		{
-			return std::make_shared<AddShaderNode>(pos);
-		}
-		case CyclesNodeType::DiffuseBSDF:
-		{
-			return std::make_shared<DiffuseBSDFNode>(pos);
-		}
-		case CyclesNodeType::GlossyBSDF:
-		{
-			return std::make_shared<GlossyBSDFNode>(pos);
-		}
-		case CyclesNodeType::TransparentBSDF:
-		{
-			return std::make_shared<TransparentBSDFNode>(pos);
-		}
-		case CyclesNodeType::RefractionBSDF:
-		{
-			return std::make_shared<RefractionBSDFNode>(pos);
-		}
-		case CyclesNodeType::GlassBSDF:
-		{
-			return std::make_shared<GlassBSDFNode>(pos);
-		}
-		case CyclesNodeType::TranslucentBSDF:
-		{
-			return std::make_shared<TranslucentBSDFNode>(pos);
-		}
-		case CyclesNodeType::AnisotropicBSDF:
-		{
-			return std::make_shared<AnisotropicBSDFNode>(pos);
-		}
-		case CyclesNodeType::VelvetBSDF:
-		{
-			return std::make_shared<VelvetBSDFNode>(pos);
-		}
-		case CyclesNodeType::ToonBSDF:
-		{
-			return std::make_shared<ToonBSDFNode>(pos);
-		}
-		case CyclesNodeType::SubsurfaceScattering:
-		{
-			return std::make_shared<SubsurfaceScatteringNode>(pos);
-		}
-		case CyclesNodeType::Emission:
-		{
-			return std::make_shared<EmissionNode>(pos);
-		}
-		case CyclesNodeType::HairBSDF:
-		{
-			return std::make_shared<HairBSDFNode>(pos);
-		}
-		case CyclesNodeType::Holdout:
-		{
-			return std::make_shared<HoldoutNode>(pos);
-		}
-		case CyclesNodeType::VolAbsorption:
-		{
-			return std::make_shared<VolumeAbsorptionNode>(pos);
-		}
-		case CyclesNodeType::VolScatter:
-		{
-			return std::make_shared<VolumeScatterNode>(pos);
-		}
-		case CyclesNodeType::BrickTex:
-		{
-			return std::make_shared<BrickTextureNode>(pos);
-		}
-		case CyclesNodeType::NoiseTex:
-		{
-			return std::make_shared<NoiseTextureNode>(pos);
-		}
-		case CyclesNodeType::WaveTex:
-		{
-			return std::make_shared<WaveTextureNode>(pos);
-		}
-		case CyclesNodeType::VoronoiTex:
-		{
-			return std::make_shared<VoronoiTextureNode>(pos);
-		}
-		case CyclesNodeType::MusgraveTex:
-		{
-			return std::make_shared<MusgraveTextureNode>(pos);
-		}
-		case CyclesNodeType::GradientTex:
-		{
-			return std::make_shared<GradientTextureNode>(pos);
-		}
-		case CyclesNodeType::MagicTex:
-		{
-			return std::make_shared<MagicTextureNode>(pos);
-		}
-		case CyclesNodeType::CheckerTex:
-		{
-			return std::make_shared<CheckerTextureNode>(pos);
-		}
-		case CyclesNodeType::MaxTex:
-		{
-			return std::make_shared<MaxTexmapShaderNode>(pos);
-		}
-		case CyclesNodeType::AmbientOcclusion:
-		{
-			return std::make_shared<AmbientOcculsionNode>(pos);
-		}
-		case CyclesNodeType::Bevel:
-		{
-			return std::make_shared<BevelNode>(pos);
-		}
-		case CyclesNodeType::CameraData:
-		{
-			return std::make_shared<CameraDataNode>(pos);
-		}
-		case CyclesNodeType::Fresnel:
-		{
-			return std::make_shared<FresnelNode>(pos);
-		}
-		case CyclesNodeType::Geometry:
-		{
-			return std::make_shared<GeometryNode>(pos);
-		}
-		case CyclesNodeType::LightPath:
-		{
-			return std::make_shared<LightPathNode>(pos);
-		}
-		case CyclesNodeType::LayerWeight:
-		{
-			return std::make_shared<LayerWeightNode>(pos);
-		}
-		case CyclesNodeType::ObjectInfo:
-		{
-			return std::make_shared<ObjectInfoNode>(pos);
-		}
-		case CyclesNodeType::RGB:
-		{
-			return std::make_shared<RGBNode>(pos);
-		}
-		case CyclesNodeType::Tangent:
-		{
-			return std::make_shared<TangentNode>(pos);
-		}
-		case CyclesNodeType::TextureCoordinate:
-		{
-			return std::make_shared<TextureCoordinateNode>(pos);
-		}
-		case CyclesNodeType::Value:
-		{
-			return std::make_shared<ValueNode>(pos);
-		}
-		case CyclesNodeType::Wireframe:
-		{
-			return std::make_shared<WireframeNode>(pos);
-		}
-		case CyclesNodeType::MixRGB:
-		{
-			return std::make_shared<MixRGBNode>(pos);
-		}
-		case CyclesNodeType::Invert:
-		{
-			return std::make_shared<InvertNode>(pos);
-		}
-		case CyclesNodeType::LightFalloff:
-		{
-			return std::make_shared<LightFalloffNode>(pos);
-		}
-		case CyclesNodeType::HSV:
-		{
-			return std::make_shared<HSVNode>(pos);
-		}
-		case CyclesNodeType::Gamma:
-		{
-			return std::make_shared<GammaNode>(pos);
-		}
-		case CyclesNodeType::BrightnessContrast:
-		{
-			return std::make_shared<BrightnessContrastNode>(pos);
-		}
-		case CyclesNodeType::RGBCurves:
-		{
-			return std::make_shared<RGBCurvesNode>(pos);
-		}
-		case CyclesNodeType::Bump:
-		{
-			return std::make_shared<BumpNode>(pos);
-		}
-		case CyclesNodeType::Displacement:
-		{
-			return std::make_shared<DisplacementNode>(pos);
-		}
-		case CyclesNodeType::NormalMap:
-		{
-			return std::make_shared<NormalMapNode>(pos);
-		}
-		case CyclesNodeType::VectorDisplacement:
-		{
-			return std::make_shared<VectorDisplacementNode>(pos);
-		}
-		case CyclesNodeType::VectorTransform:
-		{
-			return std::make_shared<VectorTransformNode>(pos);
-		}
-		case CyclesNodeType::Blackbody:
-		{
-			return std::make_shared<BlackbodyNode>(pos);
-		}
-		case CyclesNodeType::ColorRamp:
-		{
-			return std::make_shared<ColorRampNode>(pos);
-		}
-		case CyclesNodeType::CombineHSV:
-		{
-			return std::make_shared<CombineHSVNode>(pos);
-		}
-		case CyclesNodeType::CombineRGB:
-		{
-			return std::make_shared<CombineRGBNode>(pos);
-		}
-		case CyclesNodeType::CombineXYZ:
-		{
-			return std::make_shared<CombineXYZNode>(pos);
-		}
-		case CyclesNodeType::Math:
-		{
-			return std::make_shared<MathNode>(pos);
-		}
-		case CyclesNodeType::RGBtoBW:
-		{
-			return std::make_shared<RGBToBWNode>(pos);
-		}
-		case CyclesNodeType::SeparateHSV:
-		{
-			return std::make_shared<SeparateHSVNode>(pos);
-		}
-		case CyclesNodeType::SeparateRGB:
-		{
-			return std::make_shared<SeparateRGBNode>(pos);
-		}
-		case CyclesNodeType::SeparateXYZ:
-		{
-			return std::make_shared<SeparateXYZNode>(pos);
-		}
-		case CyclesNodeType::VectorMath:
-		{
-			return std::make_shared<VectorMathNode>(pos);
-		}
-		case CyclesNodeType::Wavelength:
-		{
-			return std::make_shared<WavelengthNode>(pos);
-		}
-		case CyclesNodeType::MaterialOutput:
-		{
-			return std::make_shared<MaterialOutputNode>(pos);
-		}
-		case CyclesNodeType::Unknown:
-		case CyclesNodeType::Count:
-		{
-			return nullptr;
-		}
-	}
-
-	return nullptr;
-}
-
 static std::shared_ptr<cse::EditableNode> deserialize_node(std::list<std::string>& tokens, std::map<std::string, cse::EditableNode*>& nodes_by_name)
 {
 	using namespace cse;
 
-	initialize_maps();
-
 	if (tokens.size() < 4) {
 		return nullptr;
 	}
@@ -678,19 +294,13 @@ static std::shared_ptr<cse::EditableNode> deserialize_node(std::list<std::string
 		params[param_name] = value;
 	}
 
-	if (code_to_type.count(type_code) == 0) {
+	const NodeTypeInfo* const type_info = get_node_type_info(type_code);
+	if (type_info == nullptr) {
 		// Unknown type
 		return nullptr;
 	}
 
-	CyclesNodeType type = code_to_type[type_code];
-
-	std::shared_ptr<EditableNode> result = create_node_from_type(type);
-	result->world_pos = Float2(x_position, y_position);
-
-	if (result.use_count() == 0) {
-		return nullptr;
-	}
+	std::shared_ptr<EditableNode> result = type_info->create(Float2(x_position, y_position));
 
 	for (std::pair<std::string, std::string> this_param : params) {
 		std::weak_ptr<NodeSocket> this_socket = result->get_socket_by_internal_name(SocketIOType::INPUT, this_param.first);
@@ -859,6 +469,7 @@ void cse::deserialize_graph(
 
 		NodeConnection connection(source, dest);
 		connections.push_back(connection);
+		dest.lock()->connected_count++;
 	}
 
 	// Mark all nodes as unchanged so an undo push isn't triggered
@@ -1,9 +1,11 @@
 #include "sockets.h"
 
 #include "curve.h"
+#include "node_base.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <memory>
 
 static constexpr float CURVE_CREATE_POINT_IGNORE_MARGIN = 0.012f;
@@ -14,6 +16,13 @@ static bool Float2_x_lt(const cse::Float2 a, const cse::Float2 b)
 	return a.x < b.x;
 }
 
+// Every curve or ramp edit gets a revision no other value has used, so equal revisions always mean equal points
+static std::uint64_t get_new_revision()
+{
+	static std::uint64_t next_revision = 1;
+	return next_revision++;
+}
+
 cse::IntSocketValue::IntSocketValue(int default_val, int min, int max)
 {
 	this->default_val = default_val;
@@ -28,6 +37,11 @@ cse::SocketType cse::IntSocketValue::get_type() const
 	return SocketType::INT;
 }
 
+std::shared_ptr<cse::SocketValue> cse::IntSocketValue::clone() const
+{
+	return std::make_shared<IntSocketValue>(*this);
+}
+
 int cse::IntSocketValue::get_value()
 {
 	return value;
@@ -60,6 +74,11 @@ cse::SocketType cse::FloatSocketValue::get_type() const
 	return SocketType::FLOAT;
 }
 
+std::shared_ptr<cse::SocketValue> cse::FloatSocketValue::clone() const
+{
+	return std::make_shared<FloatSocketValue>(*this);
+}
+
 float cse::FloatSocketValue::get_value()
 {
 	return value;
@@ -94,6 +113,16 @@ cse::SocketType cse::Float3SocketValue::get_type() const
 	return SocketType::VECTOR;
 }
 
+std::shared_ptr<cse::SocketValue> cse::Float3SocketValue::clone() const
+{
+	// Component values are held by pointer, so they need to be copied individually
+	const auto result = std::make_shared<Float3SocketValue>(*this);
+	result->x_socket_val = std::make_shared<FloatSocketValue>(*x_socket_val);
+	result->y_socket_val = std::make_shared<FloatSocketValue>(*y_socket_val);
+	result->z_socket_val = std::make_shared<FloatSocketValue>(*z_socket_val);
+	return result;
+}
+
 cse::Float3 cse::Float3SocketValue::get_value()
 {
 	const float x = x_socket_val->get_value();
@@ -131,6 +160,16 @@ cse::SocketType cse::ColorSocketValue::get_type() const
 	return SocketType::COLOR;
 }
 
+std::shared_ptr<cse::SocketValue> cse::ColorSocketValue::clone() const
+{
+	// Component values are held by pointer, so they need to be copied individually
+	const auto result = std::make_shared<ColorSocketValue>(*this);
+	result->r_socket_val = std::make_shared<FloatSocketValue>(*r_socket_val);
+	result->g_socket_val = std::make_shared<FloatSocketValue>(*g_socket_val);
+	result->b_socket_val = std::make_shared<FloatSocketValue>(*b_socket_val);
+	return result;
+}
+
 cse::StringEnumPair cse::StringEnumPair::make_spacer()
 {
 	StringEnumPair result = StringEnumPair("-", "-");
@@ -149,9 +188,11 @@ bool cse::StringEnumPair::is_spacer() const
 	return this_is_spacer;
 }
 
-cse::StringEnumSocketValue::StringEnumSocketValue() : value("", "")
+cse::StringEnumSocketValue::StringEnumSocketValue(const std::vector<StringEnumPair>& enum_values, const std::string& default_internal_name) :
+	value("", ""),
+	enum_values(std::make_shared<const std::vector<StringEnumPair>>(enum_values))
 {
-
+	set_from_internal_name(default_internal_name);
 }
 
 cse::SocketType cse::StringEnumSocketValue::get_type() const
@@ -159,9 +200,14 @@ cse::SocketType cse::StringEnumSocketValue::get_type() const
 	return SocketType::STRING_ENUM;
 }
 
+std::shared_ptr<cse::SocketValue> cse::StringEnumSocketValue::clone() const
+{
+	return std::make_shared<StringEnumSocketValue>(*this);
+}
+
 bool cse::StringEnumSocketValue::set_from_internal_name(std::string internal_name)
 {
-	for (StringEnumPair this_pair : enum_values) {
+	for (const StringEnumPair& this_pair : *enum_values) {
 		if (this_pair.internal_value == internal_name) {
 			value = this_pair;
 			return true;
@@ -182,7 +228,13 @@ cse::SocketType cse::BoolSocketValue::get_type() const
 	return SocketType::BOOLEAN;
 }
 
-cse::CurveSocketValue::CurveSocketValue()
+std::shared_ptr<cse::SocketValue> cse::BoolSocketValue::clone() const
+{
+	return std::make_shared<BoolSocketValue>(*this);
+}
+
+cse::CurveSocketValue::CurveSocketValue() :
+	revision(get_new_revision())
 {
 	reset_value();
 }
@@ -192,6 +244,11 @@ cse::SocketType cse::CurveSocketValue::get_type() const
 	return SocketType::CURVE;
 }
 
+std::shared_ptr<cse::SocketValue> cse::CurveSocketValue::clone() const
+{
+	return std::make_shared<CurveSocketValue>(*this);
+}
+
 void cse::CurveSocketValue::reset_value()
 {
 	curve_points.clear();
@@ -201,6 +258,7 @@ void cse::CurveSocketValue::reset_value()
 
 	curve_points.push_back(default_0);
 	curve_points.push_back(default_1);
+	revision = get_new_revision();
 }
 
 void cse::CurveSocketValue::create_point(float x)
@@ -219,6 +277,7 @@ void cse::CurveSocketValue::create_point(float x)
 
 	curve_points.push_back(Float2(x, y));
 	sort_curve_points();
+	revision = get_new_revision();
 }
 
 void cse::CurveSocketValue::delete_point(const Float2& target)
@@ -232,6 +291,7 @@ void cse::CurveSocketValue::delete_point(const Float2& target)
 
 	if (target_found) {
 		curve_points.erase(curve_points.begin() + target_index);
+		revision = get_new_revision();
 	}
 }
 
@@ -268,8 +328,11 @@ size_t cse::CurveSocketValue::move_point(const std::size_t index, const Float2&
 		assert(false);
 	}
 
-	curve_points[index] = new_point;
-	sort_curve_points();
+	if (curve_points[index] != new_point) {
+		curve_points[index] = new_point;
+		sort_curve_points();
+		revision = get_new_revision();
+	}
 
 	for (size_t i = 0; i < curve_points.size(); i++) {
 		const Float2 this_point = curve_points[i];
@@ -283,12 +346,44 @@ size_t cse::CurveSocketValue::move_point(const std::size_t index, const Float2&
 	return 0;
 }
 
+const std::vector<cse::Float2>& cse::CurveSocketValue::get_curve_points() const
+{
+	return curve_points;
+}
+
+void cse::CurveSocketValue::set_curve_points(const std::vector<Float2>& points)
+{
+	curve_points = points;
+	sort_curve_points();
+	revision = get_new_revision();
+}
+
+cse::CurveInterpolation cse::CurveSocketValue::get_curve_interp() const
+{
+	return curve_interp;
+}
+
+void cse::CurveSocketValue::set_curve_interp(const CurveInterpolation interp)
+{
+	if (interp == curve_interp) {
+		return;
+	}
+	curve_interp = interp;
+	revision = get_new_revision();
+}
+
+std::uint64_t cse::CurveSocketValue::get_revision() const
+{
+	return revision;
+}
+
 void cse::CurveSocketValue::sort_curve_points()
 {
 	std::sort(curve_points.begin(), curve_points.end(), Float2_x_lt);
 }
 
-cse::ColorRampSocketValue::ColorRampSocketValue()
+cse::ColorRampSocketValue::ColorRampSocketValue() :
+	revision(get_new_revision())
 {
 	ColorRampPoint p1(0.0f, Float3(0.0f, 0.0f, 0.0f), 1.0f);
 	ColorRampPoint p2(1.0f, Float3(1.0f, 1.0f, 1.0f), 1.0f);
@@ -301,16 +396,50 @@ cse::SocketType cse::ColorRampSocketValue::get_type() const
 	return SocketType::COLOR_RAMP;
 }
 
-std::vector<cse::Float4> cse::ColorRampSocketValue::evaluate_samples(const unsigned int count) const
+std::shared_ptr<cse::SocketValue> cse::ColorRampSocketValue::clone() const
+{
+	return std::make_shared<ColorRampSocketValue>(*this);
+}
+
+const std::vector<cse::ColorRampPoint>& cse::ColorRampSocketValue::get_ramp_points() const
+{
+	return ramp_points;
+}
+
+void cse::ColorRampSocketValue::set_ramp_points(const std::vector<ColorRampPoint>& points)
+{
+	if (points == ramp_points) {
+		return;
+	}
+	ramp_points = points;
+	revision = get_new_revision();
+}
+
+std::uint64_t cse::ColorRampSocketValue::get_revision() const
+{
+	return revision;
+}
+
+const std::vector<cse::Float4>& cse::ColorRampSocketValue::get_samples(const unsigned int count) const
 {
+	if (cached_samples_revision == revision && cached_samples.size() == count) {
+		return cached_samples;
+	}
+	cached_samples_revision = revision;
+	cached_samples.clear();
+	cached_samples.reserve(count);
+
 	constexpr float POS_BEGIN = 0.0f;
 	constexpr float POS_END = 1.0f;
 	const float POS_INCREMENT = (POS_END - POS_BEGIN) / (count - 1);
 
-	std::vector<Float4> result;
-	result.reserve(count);
+	if (ramp_points.size() == 0) {
+		// Invalid ramp, interpret as all black
+		cached_samples.assign(count, Float4(0.0f, 0.0f, 0.0f, 1.0f));
+		return cached_samples;
+	}
 
-	// Create a function-local copy of the control point vector so we can be sure it is sorted
+	// Sort a copy of the control points, the panel keeps them in the order they are edited in
 	std::vector<ColorRampPoint> ramp_points_local = this->ramp_points;
 	std::sort(
 		ramp_points_local.begin(),
@@ -320,12 +449,6 @@ std::vector<cse::Float4> cse::ColorRampSocketValue::evaluate_samples(const unsig
 		}
 	);
 
-	if (ramp_points_local.size() == 0) {
-		// Invalid ramp, interpret as all black
-		result.push_back(Float4(0.0f, 0.0f, 0.0f, 1.0f));
-		result.push_back(Float4(0.0f, 0.0f, 0.0f, 1.0f));
-	}
-
 	const float pos_first_change = ramp_points_local[0].position;
 	const Float3 color_start = ramp_points_local[0].color;
 	const float alpha_start = ramp_points_local[0].alpha;
@@ -340,11 +463,11 @@ std::vector<cse::Float4> cse::ColorRampSocketValue::evaluate_samples(const unsig
 			const float this_pos = POS_BEGIN + i * POS_INCREMENT;
 			if (this_pos <= pos_first_change) {
 				Float4 this_output(color_start.x, color_start.y, color_start.z, alpha_start);
-				result.push_back(this_output);
+				cached_samples.push_back(this_output);
 			}
 			else if (this_pos >= pos_last_change) {
 				Float4 this_output(color_end.x, color_end.y, color_end.z, alpha_end);
-				result.push_back(this_output);
+				cached_samples.push_back(this_output);
 			}
 			else {
 				while (ramp_points_local[index_search_begin + 1].position <= this_pos) {
@@ -363,13 +486,12 @@ std::vector<cse::Float4> cse::ColorRampSocketValue::evaluate_samples(const unsig
 				const float out_b = low.color.z + (high.color.z - low.color.z) * lerp_val;
 				const float out_a = low.alpha + (high.alpha - low.alpha) * lerp_val;
 
-				result.push_back(Float4(out_r, out_g, out_b, out_a));
+				cached_samples.push_back(Float4(out_r, out_g, out_b, out_a));
 			}
 		}
 	}
 
-
-	return result;
+	return cached_samples;
 }
 
 cse::Float3 cse::ColorSocketValue::get_value()
@@ -381,8 +503,7 @@ cse::Float3 cse::ColorSocketValue::get_value()
 	return result;
 }
 
-cse::NodeSocket::NodeSocket(EditableNode* parent, SocketIOType io_type, SocketType socket_type, std::string display_name, std::string internal_name) :
-	parent(parent)
+cse::SocketDefinition::SocketDefinition(SocketIOType io_type, SocketType socket_type, const std::string& display_name, const std::string& internal_name)
 {
 	this->io_type = io_type;
 	this->socket_type = socket_type;
@@ -414,6 +535,20 @@ cse::NodeSocket::NodeSocket(EditableNode* parent, SocketIOType io_type, SocketTy
 	}
 }
 
+cse::NodeSocket::NodeSocket(EditableNode* const parent, const SocketDefinition& definition) :
+	parent(parent),
+	io_type(definition.io_type),
+	socket_type(definition.socket_type),
+	display_name(definition.display_name),
+	internal_name(definition.internal_name),
+	draw_socket(definition.draw_socket),
+	selectable(definition.selectable)
+{
+	if (definition.default_value) {
+		value = definition.default_value->clone();
+	}
+}
+
 void cse::NodeSocket::set_float_val(float float_in)
 {
 	if (socket_type != SocketType::FLOAT) {
@@ -461,3 +596,13 @@ void cse::NodeSocket::set_string_val(StringEnumPair string_in)
 		string_enum_val->value = string_in;
 	}
 }
+
+bool cse::NodeSocket::is_connected() const
+{
+	return connected_count > 0;
+}
+
+cse::Float2 cse::NodeSocket::get_world_position() const
+{
+	return parent->world_pos + local_position;
+}
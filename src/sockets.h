@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -17,6 +18,9 @@ namespace cse {
 	public:
 		virtual ~SocketValue() {}
 		virtual SocketType get_type() const = 0;
+
+		// Creates an independent copy of this value, used to instantiate a socket from its definition
+		virtual std::shared_ptr<SocketValue> clone() const = 0;
 	};
 
 	class IntSocketValue : public SocketValue {
@@ -24,6 +28,7 @@ namespace cse {
 		IntSocketValue(int default_val, int min, int max);
 
 		virtual SocketType get_type() const override;
+		virtual std::shared_ptr<SocketValue> clone() const override;
 
 		int get_value();
 		void set_value(int value_in);
@@ -41,6 +46,7 @@ namespace cse {
 		FloatSocketValue(float default_val, float min, float max);
 
 		virtual SocketType get_type() const override;
+		virtual std::shared_ptr<SocketValue> clone() const override;
 
 		float get_value();
 		void set_value(float value_in);
@@ -60,6 +66,7 @@ namespace cse {
 			float default_z, float min_z, float max_z);
 
 		virtual SocketType get_type() const override;
+		virtual std::shared_ptr<SocketValue> clone() const override;
 
 		Float3 get_value();
 		void set_x(float x_in);
@@ -76,6 +83,7 @@ namespace cse {
 		ColorSocketValue(float default_r, float default_g, float default_b);
 
 		virtual SocketType get_type() const override;
+		virtual std::shared_ptr<SocketValue> clone() const override;
 
 		Float3 get_value();
 
@@ -103,14 +111,16 @@ namespace cse {
 
 	class StringEnumSocketValue : public SocketValue {
 	public:
-		StringEnumSocketValue();
+		StringEnumSocketValue(const std::vector<StringEnumPair>& enum_values, const std::string& default_internal_name);
 
 		virtual SocketType get_type() const override;
+		virtual std::shared_ptr<SocketValue> clone() const override;
 
 		bool set_from_internal_name(std::string internal_name);
 
 		StringEnumPair value;
-		std::vector<StringEnumPair> enum_values;
+		// Table of possible values, shared by every copy of this value
+		std::shared_ptr<const std::vector<StringEnumPair>> enum_values;
 	};
 
 	class BoolSocketValue : public SocketValue {
@@ -118,6 +128,7 @@ namespace cse {
 		BoolSocketValue(bool default_val);
 
 		virtual SocketType get_type() const override;
+		virtual std::shared_ptr<SocketValue> clone() const override;
 
 		bool value;
 		bool default_value;
@@ -128,6 +139,7 @@ namespace cse {
 		CurveSocketValue();
 
 		virtual SocketType get_type() const override;
+		virtual std::shared_ptr<SocketValue> clone() const override;
 
 		void reset_value();
 		void create_point(float x);
@@ -137,10 +149,22 @@ namespace cse {
 		// Move a point and return its new index
 		std::size_t move_point(std::size_t index, const Float2& new_point);
 
+		const std::vector<Float2>& get_curve_points() const;
+		// Points will be sorted by x value
+		void set_curve_points(const std::vector<Float2>& points);
+
+		CurveInterpolation get_curve_interp() const;
+		void set_curve_interp(CurveInterpolation interp);
+
+		// Changes whenever the points or interpolation change, two curves with the same revision are identical
+		std::uint64_t get_revision() const;
+
+	private:
 		void sort_curve_points();
 
 		std::vector<Float2> curve_points;
 		CurveInterpolation curve_interp = CurveInterpolation::CUBIC_HERMITE;
+		std::uint64_t revision;
 	};
 
 	class ColorRampSocketValue : public SocketValue {
@@ -148,40 +172,103 @@ namespace cse {
 		ColorRampSocketValue();
 
 		virtual SocketType get_type() const override;
+		virtual std::shared_ptr<SocketValue> clone() const override;
 
+		const std::vector<ColorRampPoint>& get_ramp_points() const;
+		// The revision only changes if the new points differ from the current ones
+		void set_ramp_points(const std::vector<ColorRampPoint>& points);
+
+		// Changes whenever the points change, two ramps with the same revision have identical points
+		std::uint64_t get_revision() const;
+
+		// Evenly spaced samples from position 0 to 1
+		// These are cached, so they are only evaluated again after the points or count change
+		const std::vector<Float4>& get_samples(unsigned int count = 256) const;
+
+	private:
 		std::vector<ColorRampPoint> ramp_points;
+		std::uint64_t revision;
+
+		mutable std::vector<Float4> cached_samples;
+		mutable std::uint64_t cached_samples_revision = 0;
+	};
+
+	// Immutable description of a socket
+	// One of these exists for each socket of each node type and is shared by all nodes of that type
+	class SocketDefinition {
+	public:
+		SocketDefinition(SocketIOType io_type, SocketType socket_type, const std::string& display_name, const std::string& internal_name);
+
+		SocketIOType io_type;
+		SocketType socket_type;
+		std::string display_name;
+		std::string internal_name;
+
+		bool draw_socket = true;
+
+		bool selectable = false;
 
-		std::vector<Float4> evaluate_samples(unsigned int count = 256) const;
+		// Value that new sockets will start with, null for sockets with no editable value
+		std::shared_ptr<const SocketValue> default_value;
+	};
+
+	// A socket's label text as drawn on its node
+	// This is cached by Drawing::draw_node so the text is only rebuilt when the value shown in it changes
+	class SocketLabelCache {
+	public:
+		bool text_valid = false;
+		bool widths_valid = false;
+
+		// Value the label was built from, only the member matching the socket's type is used
+		float float_value = 0.0f;
+		int int_value = 0;
+		bool bool_value = false;
+
+		std::string label_text;
+		// The part of the label before its value, a crossout on connected sockets starts after this
+		std::string text_before_crossout;
+
+		// Measured with the label centered at x = 0
+		float label_min_x = 0.0f;
+		float label_max_x = 0.0f;
+		float before_crossout_width = 0.0f;
 	};
 
 	class NodeSocket {
 	public:
-		NodeSocket(EditableNode* parent, SocketIOType io_type, SocketType socket_type, std::string display_name, std::string internal_name);
+		NodeSocket(EditableNode* parent, const SocketDefinition& definition);
 
 		void set_float_val(float float_in);
 		void set_float3_val(float x_in, float y_in, float z_in);
 		void set_string_val(StringEnumPair string_in);
 
+		// True if any connection in the graph ends at this socket
+		bool is_connected() const;
+
+		Float2 get_world_position() const;
+
 		EditableNode* const parent;
 
-		SocketIOType io_type;
-		SocketType socket_type;
-		std::string display_name;
-		std::string internal_name;
+		// These all refer to the socket's definition, which is owned by the parent node's schema
+		const SocketIOType io_type;
+		const SocketType socket_type;
+		const std::string& display_name;
+		const std::string& internal_name;
 
-		bool draw_socket = true;
+		const bool draw_socket;
 
-		bool selectable = false;
+		const bool selectable;
 
-		// World position where this socket was drawn last frame
-		Float2 world_draw_position;
+		// Position of this socket's connector relative to its parent node, set by the node's layout pass
+		Float2 local_position;
 
 		std::shared_ptr<SocketValue> value;
 
-		// This variable is used to track when a value should be crossed out in the UI
-		// It should be set to true prior to calling draw() when this socket's input has a connection
-		// It will be reset to false when the parent node's draw() is called
-		bool input_connected_this_frame = false;
+		SocketLabelCache label_cache;
+
+		// Number of connections ending at this socket
+		// This is kept up to date by whatever code adds or removes connections so it never needs to be recalculated
+		unsigned int connected_count = 0;
 	};
 
 }
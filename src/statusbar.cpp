@@ -1,11 +1,13 @@
 #include "statusbar.h"
 
-#include <nanovg.h>
+#include <cstdio>
 
+#include <nanovg.h>
 
 cse::NodeEditorStatusBar::NodeEditorStatusBar()
 {
 	status_text = "Node graph editor loaded";
+	set_resolution_scale(1.0f);
 }
 
 void cse::NodeEditorStatusBar::draw(NVGcontext* const draw_context, const float width)
@@ -24,13 +26,14 @@ void cse::NodeEditorStatusBar::draw(NVGcontext* const draw_context, const float
 	nvgFillColor(draw_context, nvgRGBA(0, 0, 0, 255));
 	nvgText(draw_context, 4.0f, get_status_bar_height() / 2.0f, status_text.c_str(), nullptr);
 
-	// Zoom text
+	// Zoom and resolution text
+	const std::string view_text = resolution_text + "  " + zoom_text;
 	nvgFontSize(draw_context, UI_FONT_SIZE_NORMAL);
 	nvgFontFace(draw_context, "sans");
 	nvgTextAlign(draw_context, NVG_ALIGN_RIGHT | NVG_ALIGN_MIDDLE);
 	nvgFontBlur(draw_context, 0.0f);
 	nvgFillColor(draw_context, nvgRGBA(0, 0, 0, 255));
-	nvgText(draw_context, width - 4.0f, get_status_bar_height() / 2.0f, zoom_text.c_str(), nullptr);
+	nvgText(draw_context, width - 4.0f, get_status_bar_height() / 2.0f, view_text.c_str(), nullptr);
 }
 
 void cse::NodeEditorStatusBar::set_status_text(const std::string& text)
@@ -41,4 +44,17 @@ void cse::NodeEditorStatusBar::set_status_text(const std::string& text)
 void cse::NodeEditorStatusBar::set_zoom_text(const std::string& text)
 {
 	zoom_text = text;
+}
+
+void cse::NodeEditorStatusBar::set_resolution_scale(const float scale)
+{
+	constexpr unsigned char BUFFER_SIZE = 24;
+	char buf[BUFFER_SIZE];
+	const int result = snprintf(buf, BUFFER_SIZE, "Resolution: %.0f%%", scale * 100.0f);
+	if (result <= 0) {
+		// This should never happen
+		resolution_text = "RESOLUTION ERROR";
+		return;
+	}
+	resolution_text = std::string(buf);
 }
\ No newline at end of file
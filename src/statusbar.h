@@ -18,10 +18,12 @@ namespace cse {
 
 		void set_status_text(const std::string& text);
 		void set_zoom_text(const std::string& text);
+		void set_resolution_scale(float scale);
 
 	private:
 		std::string status_text;
 		std::string zoom_text;
+		std::string resolution_text;
 	};
 
 }
\ No newline at end of file
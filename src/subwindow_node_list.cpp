@@ -1,24 +1,23 @@
 #include "subwindow_node_list.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <nanovg.h>
 #include <GLFW/glfw3.h>
 
-#include "config.h"
-
 #include "button_category.h"
 #include "buttons_nodes.h"
 #include "gui_sizes.h"
 #include "node_base.h"
-#include "node_colors.h"
-#include "node_converter.h"
-#include "node_inputs.h"
-#include "node_interop_max.h"
-#include "node_shaders.h"
-#include "node_textures.h"
-#include "node_vector.h"
+#include "node_registry.h"
+#include "output.h"
+#include "util_enum.h"
 #include "util_vector.h"
 
 cse::NodeCreationHelper::NodeCreationHelper()
@@ -65,170 +64,35 @@ cse::NodeListSubwindow::NodeListSubwindow(const std::weak_ptr<NodeCreationHelper
 
 	cat_shader_button->selected = true;
 
-	// Input buttons
-	{
-		auto ao_button = std::make_unique<GenericNodeButton<AmbientOcculsionNode>>();
-		auto bevel_button = std::make_unique<GenericNodeButton<BevelNode>>();
-		auto camera_data_button = std::make_unique<GenericNodeButton<CameraDataNode>>();
-		auto fresnel_button = std::make_unique<GenericNodeButton<FresnelNode>>();
-		auto geometry_button = std::make_unique<GenericNodeButton<GeometryNode>>();
-		auto layer_weight_button = std::make_unique<GenericNodeButton<LayerWeightNode>>();
-		auto light_path_button = std::make_unique<GenericNodeButton<LightPathNode>>();
-		auto object_info_button = std::make_unique<GenericNodeButton<ObjectInfoNode>>();
-		auto rgb_button = std::make_unique<GenericNodeButton<RGBNode>>();
-		auto tangent_button = std::make_unique<GenericNodeButton<TangentNode>>();
-		auto tex_coord_button = std::make_unique<GenericNodeButton<TextureCoordinateNode>>();
-		auto value_button = std::make_unique<GenericNodeButton<ValueNode>>();
-		auto wireframe_button = std::make_unique<GenericNodeButton<WireframeNode>>();
-
-		cat_input_button->node_buttons.push_back(std::move(ao_button));
-		cat_input_button->node_buttons.push_back(std::move(bevel_button));
-		cat_input_button->node_buttons.push_back(std::move(camera_data_button));
-		cat_input_button->node_buttons.push_back(std::move(fresnel_button));
-		cat_input_button->node_buttons.push_back(std::move(geometry_button));
-		cat_input_button->node_buttons.push_back(std::move(layer_weight_button));
-		cat_input_button->node_buttons.push_back(std::move(light_path_button));
-		cat_input_button->node_buttons.push_back(std::move(object_info_button));
-		cat_input_button->node_buttons.push_back(std::move(rgb_button));
-		cat_input_button->node_buttons.push_back(std::move(tangent_button));
-		cat_input_button->node_buttons.push_back(std::move(tex_coord_button));
-		cat_input_button->node_buttons.push_back(std::move(value_button));
-		cat_input_button->node_buttons.push_back(std::move(wireframe_button));
-	}
-
-	// Shaders buttons
-	{
-		auto add_button = std::make_unique<GenericNodeButton<AddShaderNode>>();
-		auto anisotropic_button = std::make_unique<GenericNodeButton<AnisotropicBSDFNode>>();
-		auto diffuse_button = std::make_unique<GenericNodeButton<DiffuseBSDFNode>>();
-		auto emission_button = std::make_unique<GenericNodeButton<EmissionNode>>();
-		auto glass_button = std::make_unique<GenericNodeButton<GlassBSDFNode>>();
-		auto glossy_button = std::make_unique<GenericNodeButton<GlossyBSDFNode>>();
-		auto hair_button = std::make_unique<GenericNodeButton<HairBSDFNode>>();
-		auto holdout_button = std::make_unique<GenericNodeButton<HoldoutNode>>();
-		auto mix_button = std::make_unique<GenericNodeButton<MixShaderNode>>();
-		auto principled_button = std::make_unique<GenericNodeButton<PrincipledBSDFNode>>();
-		auto principled_hair_button = std::make_unique<GenericNodeButton<PrincipledHairNode>>();
-		auto principled_volume_button = std::make_unique<GenericNodeButton<PrincipledVolumeNode>>();
-		auto refraction_button = std::make_unique<GenericNodeButton<RefractionBSDFNode>>();
-		auto sss_button = std::make_unique<GenericNodeButton<SubsurfaceScatteringNode>>();
-		auto toon_button = std::make_unique<GenericNodeButton<ToonBSDFNode>>();
-		auto translucent_button = std::make_unique<GenericNodeButton<TranslucentBSDFNode>>();
-		auto transparent_button = std::make_unique<GenericNodeButton<TransparentBSDFNode>>();
-		auto velvet_button = std::make_unique<GenericNodeButton<VelvetBSDFNode>>();
-		auto vol_absorption_button = std::make_unique<GenericNodeButton<VolumeAbsorptionNode>>();
-		auto vol_scatter_button = std::make_unique<GenericNodeButton<VolumeScatterNode>>();
-
-		cat_shader_button->node_buttons.push_back(std::move(add_button));
-		cat_shader_button->node_buttons.push_back(std::move(anisotropic_button));
-		cat_shader_button->node_buttons.push_back(std::move(diffuse_button));
-		cat_shader_button->node_buttons.push_back(std::move(emission_button));
-		cat_shader_button->node_buttons.push_back(std::move(glass_button));
-		cat_shader_button->node_buttons.push_back(std::move(glossy_button));
-		cat_shader_button->node_buttons.push_back(std::move(hair_button));
-		cat_shader_button->node_buttons.push_back(std::move(holdout_button));
-		cat_shader_button->node_buttons.push_back(std::move(mix_button));
-		cat_shader_button->node_buttons.push_back(std::move(principled_button));
-		cat_shader_button->node_buttons.push_back(std::move(principled_hair_button));
-		cat_shader_button->node_buttons.push_back(std::move(principled_volume_button));
-		cat_shader_button->node_buttons.push_back(std::move(refraction_button));
-		cat_shader_button->node_buttons.push_back(std::move(sss_button));
-		cat_shader_button->node_buttons.push_back(std::move(toon_button));
-		cat_shader_button->node_buttons.push_back(std::move(translucent_button));
-		cat_shader_button->node_buttons.push_back(std::move(transparent_button));
-		cat_shader_button->node_buttons.push_back(std::move(velvet_button));
-		cat_shader_button->node_buttons.push_back(std::move(vol_absorption_button));
-		cat_shader_button->node_buttons.push_back(std::move(vol_scatter_button));
-	}
-
-	// Texture buttons
-	{
-#ifdef INCLUDE_MAX_INTEGRATION
-		auto max_tex_button = std::make_unique<GenericNodeButton<MaxTexmapShaderNode>>();
-#endif
-		auto brick_tex_button = std::make_unique<GenericNodeButton<BrickTextureNode>>();
-		auto checker_tex_button = std::make_unique<GenericNodeButton<CheckerTextureNode>>();
-		auto gradient_tex_button = std::make_unique<GenericNodeButton<GradientTextureNode>>();
-		auto magic_tex_button = std::make_unique<GenericNodeButton<MagicTextureNode>>();
-		auto musgrave_tex_button = std::make_unique<GenericNodeButton<MusgraveTextureNode>>();
-		auto noise_tex_button = std::make_unique<GenericNodeButton<NoiseTextureNode>>();
-		auto voronoi_tex_button = std::make_unique<GenericNodeButton<VoronoiTextureNode>>();
-		auto wave_tex_button = std::make_unique<GenericNodeButton<WaveTextureNode>>();
-
-#ifdef INCLUDE_MAX_INTEGRATION
-		cat_texture_button->node_buttons.push_back(std::move(max_tex_button));
-#endif
-		cat_texture_button->node_buttons.push_back(std::move(brick_tex_button));
-		cat_texture_button->node_buttons.push_back(std::move(checker_tex_button));
-		cat_texture_button->node_buttons.push_back(std::move(gradient_tex_button));
-		cat_texture_button->node_buttons.push_back(std::move(magic_tex_button));
-		cat_texture_button->node_buttons.push_back(std::move(musgrave_tex_button));
-		cat_texture_button->node_buttons.push_back(std::move(noise_tex_button));
-		cat_texture_button->node_buttons.push_back(std::move(voronoi_tex_button));
-		cat_texture_button->node_buttons.push_back(std::move(wave_tex_button));
-	}
-
-	// Color buttons
-	{
-		auto bright_contrast_button = std::make_unique<GenericNodeButton<BrightnessContrastNode>>();
-		auto gamma_button = std::make_unique<GenericNodeButton<GammaNode>>();
-		auto hsv_button = std::make_unique<GenericNodeButton<HSVNode>>();
-		auto invert_button = std::make_unique<GenericNodeButton<InvertNode>>();
-		auto light_falloff_button = std::make_unique<GenericNodeButton<LightFalloffNode>>();
-		auto mix_rgb_button = std::make_unique<GenericNodeButton<MixRGBNode>>();
-		auto rgb_curves_button = std::make_unique<GenericNodeButton<RGBCurvesNode>>();
-
-		cat_color_button->node_buttons.push_back(std::move(bright_contrast_button));
-		cat_color_button->node_buttons.push_back(std::move(gamma_button));
-		cat_color_button->node_buttons.push_back(std::move(hsv_button));
-		cat_color_button->node_buttons.push_back(std::move(invert_button));
-		cat_color_button->node_buttons.push_back(std::move(light_falloff_button));
-		cat_color_button->node_buttons.push_back(std::move(mix_rgb_button));
-		cat_color_button->node_buttons.push_back(std::move(rgb_curves_button));
-	}
-
-	// Vector buttons
-	{
-		auto bump_button = std::make_unique<GenericNodeButton<BumpNode>>();
-		auto displacement_button = std::make_unique<GenericNodeButton<DisplacementNode>>();
-		auto normal_map_button = std::make_unique<GenericNodeButton<NormalMapNode>>();
-		auto vector_displacement_button = std::make_unique<GenericNodeButton<VectorDisplacementNode>>();
-		auto vector_transform_button = std::make_unique<GenericNodeButton<VectorTransformNode>>();
-
-		cat_vector_button->node_buttons.push_back(std::move(bump_button));
-		cat_vector_button->node_buttons.push_back(std::move(displacement_button));
-		cat_vector_button->node_buttons.push_back(std::move(normal_map_button));
-		cat_vector_button->node_buttons.push_back(std::move(vector_displacement_button));
-		cat_vector_button->node_buttons.push_back(std::move(vector_transform_button));
+	// Node buttons, each category lists its nodes alphabetically by title
+	std::vector<const NodeTypeInfo*> listed_types;
+	for (std::size_t i = 0; i < get_node_type_count(); i++) {
+		const NodeTypeInfo* const this_type = get_node_type_info(static_cast<CyclesNodeType>(i));
+		if (this_type->in_node_list) {
+			listed_types.push_back(this_type);
+		}
 	}
-
-	// Converter buttons
-	{
-		auto blackbody_button = std::make_unique<GenericNodeButton<BlackbodyNode>>();
-		auto color_ramp_button = std::make_unique<GenericNodeButton<ColorRampNode>>();
-		auto combine_hsv_button = std::make_unique<GenericNodeButton<CombineHSVNode>>();
-		auto combine_rgb_button = std::make_unique<GenericNodeButton<CombineRGBNode>>();
-		auto combine_xyz_button = std::make_unique<GenericNodeButton<CombineXYZNode>>();
-		auto math_button = std::make_unique<GenericNodeButton<MathNode>>();
-		auto rgb_to_bw_button = std::make_unique<GenericNodeButton<RGBToBWNode>>();
-		auto separate_hsv_button = std::make_unique<GenericNodeButton<SeparateHSVNode>>();
-		auto separate_rgb_button = std::make_unique<GenericNodeButton<SeparateRGBNode>>();
-		auto separate_xyz_button = std::make_unique<GenericNodeButton<SeparateXYZNode>>();
-		auto vector_math_button = std::make_unique<GenericNodeButton<VectorMathNode>>();
-		auto wavelength_button = std::make_unique<GenericNodeButton<WavelengthNode>>();
-
-		cat_converter_button->node_buttons.push_back(std::move(blackbody_button));
-		cat_converter_button->node_buttons.push_back(std::move(color_ramp_button));
-		cat_converter_button->node_buttons.push_back(std::move(combine_hsv_button));
-		cat_converter_button->node_buttons.push_back(std::move(combine_rgb_button));
-		cat_converter_button->node_buttons.push_back(std::move(combine_xyz_button));
-		cat_converter_button->node_buttons.push_back(std::move(math_button));
-		cat_converter_button->node_buttons.push_back(std::move(rgb_to_bw_button));
-		cat_converter_button->node_buttons.push_back(std::move(separate_hsv_button));
-		cat_converter_button->node_buttons.push_back(std::move(separate_rgb_button));
-		cat_converter_button->node_buttons.push_back(std::move(separate_xyz_button));
-		cat_converter_button->node_buttons.push_back(std::move(vector_math_button));
-		cat_converter_button->node_buttons.push_back(std::move(wavelength_button));
+	std::sort(
+		listed_types.begin(),
+		listed_types.end(),
+		[](const NodeTypeInfo* const lhs, const NodeTypeInfo* const rhs) {
+			return std::strcmp(lhs->title, rhs->title) < 0;
+		}
+	);
+
+	std::map<NodeCategory, NodeCategoryButton*> buttons_by_category;
+	buttons_by_category[NodeCategory::INPUT] = cat_input_button.get();
+	buttons_by_category[NodeCategory::SHADER] = cat_shader_button.get();
+	buttons_by_category[NodeCategory::TEXTURE] = cat_texture_button.get();
+	buttons_by_category[NodeCategory::COLOR] = cat_color_button.get();
+	buttons_by_category[NodeCategory::VECTOR] = cat_vector_button.get();
+	buttons_by_category[NodeCategory::CONVERTER] = cat_converter_button.get();
+
+	for (const NodeTypeInfo* const this_type : listed_types) {
+		if (buttons_by_category.count(this_type->category) == 0) {
+			continue;
+		}
+		buttons_by_category[this_type->category]->node_buttons.push_back(std::make_unique<NodeTypeButton>(*this_type));
 	}
 
 	// Add category buttons at the end because we need to std::move them into the list
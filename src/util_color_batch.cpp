@@ -0,0 +1,436 @@
+#include "util_color_batch.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CSE_COLOR_BATCH_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only allow intrinsics for instruction sets enabled for the function they are used in
+// Kernels are marked individually so the rest of the program does not require these instruction sets
+#if defined(__GNUC__)
+#define CSE_TARGET_SSE2 __attribute__((target("sse2")))
+#define CSE_TARGET_AVX __attribute__((target("avx")))
+#else
+#define CSE_TARGET_SSE2
+#define CSE_TARGET_AVX
+#endif
+
+static constexpr std::size_t BUFFER_ALIGN_BYTES = cse::ColorBuffer::ALIGN_FLOATS * sizeof(float);
+
+static constexpr float ONE_SIXTH = 1.0f / 6.0f;
+static constexpr float ONE_THIRD = 1.0f / 3.0f;
+static constexpr float TWO_THIRDS = 2.0f / 3.0f;
+
+cse::ColorBuffer::ColorBuffer(const std::size_t size) :
+	color_count(size),
+	stride((size + ALIGN_FLOATS - 1) / ALIGN_FLOATS * ALIGN_FLOATS),
+	// Extra room so the start can be moved forward to an aligned address
+	storage(new float[3 * stride + ALIGN_FLOATS]())
+{
+	const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage.get());
+	const std::uintptr_t aligned_address = (address + BUFFER_ALIGN_BYTES - 1) / BUFFER_ALIGN_BYTES * BUFFER_ALIGN_BYTES;
+	channels = storage.get() + (aligned_address - address) / sizeof(float);
+}
+
+std::size_t cse::ColorBuffer::size() const
+{
+	return color_count;
+}
+
+std::size_t cse::ColorBuffer::padded_size() const
+{
+	return stride;
+}
+
+cse::Float3 cse::ColorBuffer::get(const std::size_t index) const
+{
+	assert(index < color_count);
+	return Float3(x()[index], y()[index], z()[index]);
+}
+
+void cse::ColorBuffer::set(const std::size_t index, const Float3 value)
+{
+	assert(index < color_count);
+	x()[index] = value.x;
+	y()[index] = value.y;
+	z()[index] = value.z;
+}
+
+float* cse::ColorBuffer::x()
+{
+	return channels;
+}
+
+float* cse::ColorBuffer::y()
+{
+	return channels + stride;
+}
+
+float* cse::ColorBuffer::z()
+{
+	return channels + 2 * stride;
+}
+
+const float* cse::ColorBuffer::x() const
+{
+	return channels;
+}
+
+const float* cse::ColorBuffer::y() const
+{
+	return channels + stride;
+}
+
+const float* cse::ColorBuffer::z() const
+{
+	return channels + 2 * stride;
+}
+
+// Scalar kernels, these are the reference for the others and are used on CPUs without SSE2
+
+static void rgb_as_hsv_scalar(const cse::ColorBuffer& in, cse::ColorBuffer& out)
+{
+	for (std::size_t i = 0; i < in.padded_size(); i++) {
+		const cse::Float3 hsv = cse::Float3(in.x()[i], in.y()[i], in.z()[i]).rgb_as_hsv();
+		out.x()[i] = hsv.x;
+		out.y()[i] = hsv.y;
+		out.z()[i] = hsv.z;
+	}
+}
+
+static void hsv_as_rgb_scalar(const cse::ColorBuffer& in, cse::ColorBuffer& out)
+{
+	for (std::size_t i = 0; i < in.padded_size(); i++) {
+		const cse::Float3 rgb = cse::Float3(in.x()[i], in.y()[i], in.z()[i]).hsv_as_rgb();
+		out.x()[i] = rgb.x;
+		out.y()[i] = rgb.y;
+		out.z()[i] = rgb.z;
+	}
+}
+
+#ifdef CSE_COLOR_BATCH_X86
+
+// SSE2 kernels, 4 colors at a time
+// SSE2 has no blend instruction so selects are built from and/andnot/or
+
+CSE_TARGET_SSE2 static inline __m128 select_sse2(const __m128 mask, const __m128 if_true, const __m128 if_false)
+{
+	return _mm_or_ps(_mm_and_ps(mask, if_true), _mm_andnot_ps(mask, if_false));
+}
+
+CSE_TARGET_SSE2 static void rgb_as_hsv_sse2(const cse::ColorBuffer& in, cse::ColorBuffer& out)
+{
+	const float* const in_x = in.x();
+	const float* const in_y = in.y();
+	const float* const in_z = in.z();
+	float* const out_x = out.x();
+	float* const out_y = out.y();
+	float* const out_z = out.z();
+	const std::size_t count = in.padded_size();
+
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 neg_one = _mm_set1_ps(-1.0f);
+	const __m128 one_sixth = _mm_set1_ps(ONE_SIXTH);
+	const __m128 one_third = _mm_set1_ps(ONE_THIRD);
+	const __m128 two_thirds = _mm_set1_ps(TWO_THIRDS);
+
+	for (std::size_t i = 0; i < count; i += 4) {
+		const __m128 r = _mm_load_ps(in_x + i);
+		const __m128 g = _mm_load_ps(in_y + i);
+		const __m128 b = _mm_load_ps(in_z + i);
+
+		const __m128 max = _mm_max_ps(r, _mm_max_ps(g, b));
+		const __m128 min = _mm_min_ps(r, _mm_min_ps(g, b));
+		const __m128 range = _mm_sub_ps(max, min);
+		// Lanes with no hue, the divisions below give inf or nan for these and are replaced at the end
+		const __m128 no_hue = _mm_or_ps(_mm_cmple_ps(range, zero), _mm_cmple_ps(max, zero));
+
+		const __m128 sat = _mm_div_ps(range, max);
+
+		// Each hue offset has a range of [-1, 1], scaled here to [-1/6, 1/6]
+		const __m128 offset_scale = _mm_div_ps(one_sixth, range);
+		const __m128 red_offset = _mm_mul_ps(_mm_sub_ps(g, b), offset_scale);
+		const __m128 red_hue = _mm_add_ps(red_offset, _mm_and_ps(_mm_cmplt_ps(red_offset, zero), one));
+		const __m128 green_hue = _mm_add_ps(one_third, _mm_mul_ps(_mm_sub_ps(b, r), offset_scale));
+		const __m128 blue_hue = _mm_add_ps(two_thirds, _mm_mul_ps(_mm_sub_ps(r, g), offset_scale));
+
+		__m128 hue = select_sse2(_mm_cmpeq_ps(g, max), green_hue, blue_hue);
+		hue = select_sse2(_mm_cmpeq_ps(r, max), red_hue, hue);
+
+		_mm_store_ps(out_x + i, select_sse2(no_hue, neg_one, hue));
+		_mm_store_ps(out_y + i, select_sse2(no_hue, zero, sat));
+		_mm_store_ps(out_z + i, max);
+	}
+}
+
+CSE_TARGET_SSE2 static void hsv_as_rgb_sse2(const cse::ColorBuffer& in, cse::ColorBuffer& out)
+{
+	const float* const in_x = in.x();
+	const float* const in_y = in.y();
+	const float* const in_z = in.z();
+	float* const out_x = out.x();
+	float* const out_y = out.y();
+	float* const out_z = out.z();
+	const std::size_t count = in.padded_size();
+
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 six = _mm_set1_ps(6.0f);
+
+	for (std::size_t i = 0; i < count; i += 4) {
+		const __m128 hue = _mm_load_ps(in_x + i);
+		const __m128 sat = _mm_load_ps(in_y + i);
+		const __m128 val = _mm_load_ps(in_z + i);
+
+		// max returns its second argument for nan, so nan hue becomes 0 the same as std::max in the scalar version
+		const __m128 base_hue = _mm_min_ps(_mm_max_ps(hue, zero), one);
+		const __m128 scaled_hue = _mm_mul_ps(base_hue, six);
+		const __m128 hue_bucket = _mm_cvtepi32_ps(_mm_cvttps_epi32(scaled_hue));
+		const __m128 hue_offset = _mm_sub_ps(scaled_hue, hue_bucket);
+		const __m128 p = _mm_mul_ps(val, _mm_sub_ps(one, sat));
+		const __m128 q = _mm_mul_ps(val, _mm_sub_ps(one, _mm_mul_ps(sat, hue_offset)));
+		const __m128 t = _mm_mul_ps(val, _mm_sub_ps(one, _mm_mul_ps(sat, _mm_sub_ps(one, hue_offset))));
+
+		// Start with bucket 5, which also covers a hue of exactly 1, then replace lanes in the other buckets
+		__m128 r = val;
+		__m128 g = p;
+		__m128 b = q;
+		const __m128 is_0 = _mm_cmpeq_ps(hue_bucket, _mm_set1_ps(0.0f));
+		const __m128 is_1 = _mm_cmpeq_ps(hue_bucket, _mm_set1_ps(1.0f));
+		const __m128 is_2 = _mm_cmpeq_ps(hue_bucket, _mm_set1_ps(2.0f));
+		const __m128 is_3 = _mm_cmpeq_ps(hue_bucket, _mm_set1_ps(3.0f));
+		const __m128 is_4 = _mm_cmpeq_ps(hue_bucket, _mm_set1_ps(4.0f));
+		r = select_sse2(is_0, val, r);
+		g = select_sse2(is_0, t, g);
+		b = select_sse2(is_0, p, b);
+		r = select_sse2(is_1, q, r);
+		g = select_sse2(is_1, val, g);
+		b = select_sse2(is_1, p, b);
+		r = select_sse2(is_2, p, r);
+		g = select_sse2(is_2, val, g);
+		b = select_sse2(is_2, t, b);
+		r = select_sse2(is_3, p, r);
+		g = select_sse2(is_3, q, g);
+		b = select_sse2(is_3, val, b);
+		r = select_sse2(is_4, t, r);
+		g = select_sse2(is_4, p, g);
+		b = select_sse2(is_4, val, b);
+
+		// Monochromatic colors
+		const __m128 no_sat = _mm_cmple_ps(sat, zero);
+		_mm_store_ps(out_x + i, select_sse2(no_sat, val, r));
+		_mm_store_ps(out_y + i, select_sse2(no_sat, val, g));
+		_mm_store_ps(out_z + i, select_sse2(no_sat, val, b));
+	}
+}
+
+// AVX kernels, 8 colors at a time
+// These follow the SSE2 kernels exactly
+// Buffer pointers are read before the loop so no calls to non-AVX code happen inside it
+// Selects use and/andnot/or rather than blendv, GCC splits blendv into scalar code when only AVX is enabled
+
+CSE_TARGET_AVX static inline __m256 select_avx(const __m256 mask, const __m256 if_true, const __m256 if_false)
+{
+	return _mm256_or_ps(_mm256_and_ps(mask, if_true), _mm256_andnot_ps(mask, if_false));
+}
+
+CSE_TARGET_AVX static void rgb_as_hsv_avx(const cse::ColorBuffer& in, cse::ColorBuffer& out)
+{
+	const float* const in_x = in.x();
+	const float* const in_y = in.y();
+	const float* const in_z = in.z();
+	float* const out_x = out.x();
+	float* const out_y = out.y();
+	float* const out_z = out.z();
+	const std::size_t count = in.padded_size();
+
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 neg_one = _mm256_set1_ps(-1.0f);
+	const __m256 one_sixth = _mm256_set1_ps(ONE_SIXTH);
+	const __m256 one_third = _mm256_set1_ps(ONE_THIRD);
+	const __m256 two_thirds = _mm256_set1_ps(TWO_THIRDS);
+
+	for (std::size_t i = 0; i < count; i += 8) {
+		const __m256 r = _mm256_load_ps(in_x + i);
+		const __m256 g = _mm256_load_ps(in_y + i);
+		const __m256 b = _mm256_load_ps(in_z + i);
+
+		const __m256 max = _mm256_max_ps(r, _mm256_max_ps(g, b));
+		const __m256 min = _mm256_min_ps(r, _mm256_min_ps(g, b));
+		const __m256 range = _mm256_sub_ps(max, min);
+		const __m256 no_hue = _mm256_or_ps(_mm256_cmp_ps(range, zero, _CMP_LE_OQ), _mm256_cmp_ps(max, zero, _CMP_LE_OQ));
+
+		const __m256 sat = _mm256_div_ps(range, max);
+
+		const __m256 offset_scale = _mm256_div_ps(one_sixth, range);
+		const __m256 red_offset = _mm256_mul_ps(_mm256_sub_ps(g, b), offset_scale);
+		const __m256 red_hue = _mm256_add_ps(red_offset, _mm256_and_ps(_mm256_cmp_ps(red_offset, zero, _CMP_LT_OQ), one));
+		const __m256 green_hue = _mm256_add_ps(one_third, _mm256_mul_ps(_mm256_sub_ps(b, r), offset_scale));
+		const __m256 blue_hue = _mm256_add_ps(two_thirds, _mm256_mul_ps(_mm256_sub_ps(r, g), offset_scale));
+
+		__m256 hue = select_avx(_mm256_cmp_ps(g, max, _CMP_EQ_OQ), green_hue, blue_hue);
+		hue = select_avx(_mm256_cmp_ps(r, max, _CMP_EQ_OQ), red_hue, hue);
+
+		_mm256_store_ps(out_x + i, select_avx(no_hue, neg_one, hue));
+		_mm256_store_ps(out_y + i, select_avx(no_hue, zero, sat));
+		_mm256_store_ps(out_z + i, max);
+	}
+}
+
+CSE_TARGET_AVX static void hsv_as_rgb_avx(const cse::ColorBuffer& in, cse::ColorBuffer& out)
+{
+	const float* const in_x = in.x();
+	const float* const in_y = in.y();
+	const float* const in_z = in.z();
+	float* const out_x = out.x();
+	float* const out_y = out.y();
+	float* const out_z = out.z();
+	const std::size_t count = in.padded_size();
+
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 six = _mm256_set1_ps(6.0f);
+
+	for (std::size_t i = 0; i < count; i += 8) {
+		const __m256 hue = _mm256_load_ps(in_x + i);
+		const __m256 sat = _mm256_load_ps(in_y + i);
+		const __m256 val = _mm256_load_ps(in_z + i);
+
+		const __m256 base_hue = _mm256_min_ps(_mm256_max_ps(hue, zero), one);
+		const __m256 scaled_hue = _mm256_mul_ps(base_hue, six);
+		const __m256 hue_bucket = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(scaled_hue));
+		const __m256 hue_offset = _mm256_sub_ps(scaled_hue, hue_bucket);
+		const __m256 p = _mm256_mul_ps(val, _mm256_sub_ps(one, sat));
+		const __m256 q = _mm256_mul_ps(val, _mm256_sub_ps(one, _mm256_mul_ps(sat, hue_offset)));
+		const __m256 t = _mm256_mul_ps(val, _mm256_sub_ps(one, _mm256_mul_ps(sat, _mm256_sub_ps(one, hue_offset))));
+
+		__m256 r = val;
+		__m256 g = p;
+		__m256 b = q;
+		const __m256 is_0 = _mm256_cmp_ps(hue_bucket, _mm256_set1_ps(0.0f), _CMP_EQ_OQ);
+		const __m256 is_1 = _mm256_cmp_ps(hue_bucket, _mm256_set1_ps(1.0f), _CMP_EQ_OQ);
+		const __m256 is_2 = _mm256_cmp_ps(hue_bucket, _mm256_set1_ps(2.0f), _CMP_EQ_OQ);
+		const __m256 is_3 = _mm256_cmp_ps(hue_bucket, _mm256_set1_ps(3.0f), _CMP_EQ_OQ);
+		const __m256 is_4 = _mm256_cmp_ps(hue_bucket, _mm256_set1_ps(4.0f), _CMP_EQ_OQ);
+		r = select_avx(is_0, val, r);
+		g = select_avx(is_0, t, g);
+		b = select_avx(is_0, p, b);
+		r = select_avx(is_1, q, r);
+		g = select_avx(is_1, val, g);
+		b = select_avx(is_1, p, b);
+		r = select_avx(is_2, p, r);
+		g = select_avx(is_2, val, g);
+		b = select_avx(is_2, t, b);
+		r = select_avx(is_3, p, r);
+		g = select_avx(is_3, q, g);
+		b = select_avx(is_3, val, b);
+		r = select_avx(is_4, t, r);
+		g = select_avx(is_4, p, g);
+		b = select_avx(is_4, val, b);
+
+		const __m256 no_sat = _mm256_cmp_ps(sat, zero, _CMP_LE_OQ);
+		_mm256_store_ps(out_x + i, select_avx(no_sat, val, r));
+		_mm256_store_ps(out_y + i, select_avx(no_sat, val, g));
+		_mm256_store_ps(out_z + i, select_avx(no_sat, val, b));
+	}
+}
+
+static cse::SimdLevel detect_simd_level()
+{
+#if defined(__GNUC__)
+	__builtin_cpu_init();
+	// This also checks that the OS saves AVX registers
+	if (__builtin_cpu_supports("avx")) {
+		return cse::SimdLevel::AVX;
+	}
+	if (__builtin_cpu_supports("sse2")) {
+		return cse::SimdLevel::SSE2;
+	}
+	return cse::SimdLevel::SCALAR;
+#elif defined(_MSC_VER)
+	int cpu_info[4];
+	__cpuid(cpu_info, 1);
+	const bool has_sse2 = (cpu_info[3] & (1 << 26)) != 0;
+	const bool has_avx = (cpu_info[2] & (1 << 28)) != 0;
+	const bool has_osxsave = (cpu_info[2] & (1 << 27)) != 0;
+	// The OS must also save the upper halves of the AVX registers
+	if (has_avx && has_osxsave && (_xgetbv(0) & 0x6) == 0x6) {
+		return cse::SimdLevel::AVX;
+	}
+	if (has_sse2) {
+		return cse::SimdLevel::SSE2;
+	}
+	return cse::SimdLevel::SCALAR;
+#else
+	return cse::SimdLevel::SCALAR;
+#endif
+}
+
+#else
+
+static cse::SimdLevel detect_simd_level()
+{
+	return cse::SimdLevel::SCALAR;
+}
+
+#endif
+
+cse::SimdLevel cse::get_simd_level()
+{
+	static const SimdLevel level = detect_simd_level();
+	return level;
+}
+
+void cse::rgb_as_hsv(const ColorBuffer& in, ColorBuffer& out)
+{
+	rgb_as_hsv(in, out, get_simd_level());
+}
+
+void cse::hsv_as_rgb(const ColorBuffer& in, ColorBuffer& out)
+{
+	hsv_as_rgb(in, out, get_simd_level());
+}
+
+void cse::rgb_as_hsv(const ColorBuffer& in, ColorBuffer& out, const SimdLevel level)
+{
+	assert(in.size() == out.size());
+	const SimdLevel supported_level = std::min(level, get_simd_level());
+#ifdef CSE_COLOR_BATCH_X86
+	if (supported_level == SimdLevel::AVX) {
+		rgb_as_hsv_avx(in, out);
+		return;
+	}
+	if (supported_level == SimdLevel::SSE2) {
+		rgb_as_hsv_sse2(in, out);
+		return;
+	}
+#endif
+	rgb_as_hsv_scalar(in, out);
+}
+
+void cse::hsv_as_rgb(const ColorBuffer& in, ColorBuffer& out, const SimdLevel level)
+{
+	assert(in.size() == out.size());
+	const SimdLevel supported_level = std::min(level, get_simd_level());
+#ifdef CSE_COLOR_BATCH_X86
+	if (supported_level == SimdLevel::AVX) {
+		hsv_as_rgb_avx(in, out);
+		return;
+	}
+	if (supported_level == SimdLevel::SSE2) {
+		hsv_as_rgb_sse2(in, out);
+		return;
+	}
+#endif
+	hsv_as_rgb_scalar(in, out);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "util_enum.h"
+#include "util_vector.h"
+
+namespace cse {
+
+	// Colors stored as one array per channel, each array starts on a 32 byte boundary
+	// Arrays are padded to a whole number of AVX vectors so batched functions never need a scalar tail
+	class ColorBuffer {
+	public:
+		static constexpr std::size_t ALIGN_FLOATS = 8;
+
+		ColorBuffer(std::size_t size);
+
+		ColorBuffer(const ColorBuffer&) = delete;
+		ColorBuffer& operator=(const ColorBuffer&) = delete;
+		ColorBuffer(ColorBuffer&&) = default;
+		ColorBuffer& operator=(ColorBuffer&&) = default;
+
+		std::size_t size() const;
+		// Length of each channel array, padding values are initialized to 0
+		std::size_t padded_size() const;
+
+		Float3 get(std::size_t index) const;
+		void set(std::size_t index, Float3 value);
+
+		// Channel arrays, each holds padded_size() values
+		float* x();
+		float* y();
+		float* z();
+		const float* x() const;
+		const float* y() const;
+		const float* z() const;
+
+	private:
+		std::size_t color_count;
+		std::size_t stride;
+		std::unique_ptr<float[]> storage;
+		float* channels;
+	};
+
+	// Most capable level supported by this CPU and OS, this is checked once and then cached
+	SimdLevel get_simd_level();
+
+	// Batched versions of Float3::rgb_as_hsv and Float3::hsv_as_rgb
+	// in and out must be the same size and may be the same buffer
+	void rgb_as_hsv(const ColorBuffer& in, ColorBuffer& out);
+	void hsv_as_rgb(const ColorBuffer& in, ColorBuffer& out);
+
+	// Same as above but with a specific level, levels above get_simd_level() will use get_simd_level() instead
+	void rgb_as_hsv(const ColorBuffer& in, ColorBuffer& out, SimdLevel level);
+	void hsv_as_rgb(const ColorBuffer& in, ColorBuffer& out, SimdLevel level);
+}
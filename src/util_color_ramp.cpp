@@ -7,3 +7,19 @@ cse::ColorRampPoint::ColorRampPoint(const float position, const Float3 color, co
 {
 
 }
+
+bool cse::ColorRampPoint::operator==(const ColorRampPoint& other) const
+{
+	return (
+		position == other.position &&
+		color.x == other.color.x &&
+		color.y == other.color.y &&
+		color.z == other.color.z &&
+		alpha == other.alpha
+	);
+}
+
+bool cse::ColorRampPoint::operator!=(const ColorRampPoint& other) const
+{
+	return (*this == other) == false;
+}
@@ -6,6 +6,9 @@ namespace cse {
 	struct ColorRampPoint {
 		ColorRampPoint(float position, Float3 color, float alpha);
 
+		bool operator==(const ColorRampPoint& other) const;
+		bool operator!=(const ColorRampPoint& other) const;
+
 		float position;
 		Float3 color;
 		float alpha;
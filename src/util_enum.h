@@ -17,6 +17,13 @@ namespace cse {
 		MATERIAL,
 	};
 
+	// Amount of detail used when drawing the graph, less detail is used as the view zooms out
+	enum class DrawDetail {
+		FULL,
+		SIMPLE,  // Nodes are drawn without text or sockets
+		MINIMAL, // Same as SIMPLE, and connections are drawn as straight lines
+	};
+
 	enum class EditCurveMode {
 		MOVE,
 		CREATE,
@@ -28,6 +35,13 @@ namespace cse {
 		CUBIC_HERMITE,
 	};
 
+	// Instruction sets used by batched math, in order of preference
+	enum class SimdLevel {
+		SCALAR,
+		SSE2,
+		AVX,
+	};
+
 	enum class SocketIOType {
 		INPUT,
 		OUTPUT,
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cse {
+
+	// Hashes are 64-bit FNV-1a, start from HASH_SEED and add values in order
+	constexpr std::uint64_t HASH_SEED = 14695981039346656037ull;
+
+	inline void hash_bytes(std::uint64_t& hash, const void* const data, const std::size_t length)
+	{
+		const unsigned char* const bytes = static_cast<const unsigned char*>(data);
+		for (std::size_t i = 0; i < length; i++) {
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+	}
+
+	template<typename T> inline void hash_value(std::uint64_t& hash, const T value)
+	{
+		unsigned char bytes[sizeof(T)];
+		std::memcpy(bytes, &value, sizeof(T));
+		hash_bytes(hash, bytes, sizeof(T));
+	}
+
+}
@@ -11,8 +11,3 @@ cse::CubicHermiteSplineInterpolator::CubicHermiteSplineInterpolator(float A, flo
 {
 
 }
-
-float cse::CubicHermiteSplineInterpolator::eval(float t) const
-{
-	return a*t*t*t + b*t*t + c*t + d;
-}
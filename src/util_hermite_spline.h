@@ -5,7 +5,16 @@ namespace cse {
 	public:
 		CubicHermiteSplineInterpolator(float A, float B, float C, float D);
 
-		float eval(float t) const;
+		// These are defined here so they can be inlined into loops that evaluate many values of t
+		float eval(const float t) const
+		{
+			return ((a*t + b)*t + c)*t + d;
+		}
+		// First derivative with respect to t
+		float eval_derivative(const float t) const
+		{
+			return (3.0f*a*t + 2.0f*b)*t + c;
+		}
 
 	private:
 		const float a;
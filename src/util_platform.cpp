@@ -1,5 +1,8 @@
 #include "util_platform.h"
 
+#include <fstream>
+#include <iterator>
+
 #ifdef _WIN32
 #include <Windows.h>
 #else
@@ -30,6 +33,26 @@ cse::PathString cse::Platform::get_font_path(const PathString& search_path, cons
 	return search_path + PATH_SEPARATOR + get_pathstring(filename);
 }
 
+bool cse::Platform::read_file(const PathString& path, std::vector<unsigned char>& contents)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (file.is_open() == false) {
+		return false;
+	}
+	contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return file.bad() == false;
+}
+
+bool cse::Platform::write_file(const PathString& path, const std::vector<unsigned char>& contents)
+{
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (file.is_open() == false) {
+		return false;
+	}
+	file.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+	return file.good();
+}
+
 void cse::Platform::nvg_create_font(const PathString& path, const std::string& name, const std::unique_ptr<NvgContext>& nvg_context)
 {
 #ifdef _WIN32
@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cse {
 #ifdef _WIN32
@@ -18,6 +19,10 @@ namespace cse {
 		PathString get_pathstring(const std::string& input);
 		PathString get_font_path(const PathString& search_path, const std::string& filename);
 
+		// Both return false if the file could not be opened
+		bool read_file(const PathString& path, std::vector<unsigned char>& contents);
+		bool write_file(const PathString& path, const std::vector<unsigned char>& contents);
+
 		void nvg_create_font(const PathString& path, const std::string& name, const std::unique_ptr<NvgContext>& nvg_context);
 
 		int get_delete_key();
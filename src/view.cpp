@@ -1,8 +1,10 @@
 #include "view.h"
 
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <list>
+#include <vector>
 
 #include <GLFW/glfw3.h>
 #include <nanovg.h>
@@ -10,17 +12,35 @@
 #include "drawing.h"
 #include "editable_graph.h"
 #include "node_base.h"
+#include "node_raster_cache.h"
 #include "selection.h"
 #include "sockets.h"
 #include "subwindow_node_list.h"
 #include "ui_requests.h"
 #include "util_area.h"
 #include "util_enum.h"
+#include "util_hash.h"
 #include "util_platform.h"
 
 static constexpr int GRID_SIZE_INT = 36;
 static constexpr float GRID_SIZE_FL = static_cast<float>(GRID_SIZE_INT);
 
+// Zoom scales below which less detail is drawn
+// At the simple threshold node text is under 9 pixels tall and no longer readable
+static constexpr float DRAW_DETAIL_SIMPLE_SCALE = 0.45f;
+static constexpr float DRAW_DETAIL_MINIMAL_SCALE = 0.35f;
+
+static cse::DrawDetail get_draw_detail(const float zoom_scale)
+{
+	if (zoom_scale < DRAW_DETAIL_MINIMAL_SCALE) {
+		return cse::DrawDetail::MINIMAL;
+	}
+	if (zoom_scale < DRAW_DETAIL_SIMPLE_SCALE) {
+		return cse::DrawDetail::SIMPLE;
+	}
+	return cse::DrawDetail::FULL;
+}
+
 cse::EditGraphView::ViewBorders::ViewBorders(
 	const Float2 view_center,
 	const int viewport_width,
@@ -36,11 +56,16 @@ cse::EditGraphView::ViewBorders::ViewBorders(
 }
 
 cse::EditGraphView::EditGraphView(const std::shared_ptr<EditableGraph> graph, const std::weak_ptr<NodeCreationHelper> node_creation_helper)
-	: graph(graph), node_creation_helper(node_creation_helper), selection(std::make_shared<Selection>())
+	: graph(graph), node_creation_helper(node_creation_helper), selection(std::make_shared<Selection>()), node_cache(std::make_unique<NodeRasterCache>())
 {
 	view_center = Float2(0.0f, 0.0f);
 }
 
+cse::EditGraphView::~EditGraphView()
+{
+	// Empty destructor is needed so incomplete NodeRasterCache type can be used in the header
+}
+
 void cse::EditGraphView::set_mouse_position(const Float2 view_local_mouse_pos, const int viewport_width, const int viewport_height)
 {
 	widget_width = viewport_width;
@@ -67,7 +92,7 @@ void cse::EditGraphView::set_mouse_position(const Float2 view_local_mouse_pos, c
 
 	if (node_move_active) {
 		if (mouse_delta.is_nonzero()) {
-			selection->move_nodes(mouse_delta);
+			selection->move_nodes(graph->nodes, mouse_delta);
 			node_move_did_something = true;
 		}
 	}
@@ -94,80 +119,84 @@ void cse::EditGraphView::draw(NVGcontext* draw_context)
 	nvgTranslate(draw_context, -1 * borders.left * zoom_scale, -1 * borders.top * zoom_scale);
 	nvgScale(draw_context, zoom_scale, zoom_scale);
 
-	// Draw lightest grid
-	{
-		nvgBeginPath(draw_context);
-		nvgStrokeWidth(draw_context, 1.2f);
-		nvgStrokeColor(draw_context, nvgRGBAf(0.0f, 0.0f, 0.0f, 0.28f));
-
-		// Horizontal
-		float next_line_y = floor(borders.top / GRID_SIZE_FL) * GRID_SIZE_FL;
-		while (next_line_y < borders.bottom) {
-			nvgMoveTo(draw_context, borders.left, next_line_y);
-			nvgLineTo(draw_context, borders.right, next_line_y);
-			next_line_y += GRID_SIZE_FL;
-		}
-		// Vertical
-		float next_line_x = floor(borders.left / GRID_SIZE_FL) * GRID_SIZE_FL;
-		while (next_line_x < borders.right) {
-			nvgMoveTo(draw_context, next_line_x, borders.top);
-			nvgLineTo(draw_context, next_line_x, borders.bottom);
-			next_line_x += GRID_SIZE_FL;
-		}
+	// Grid, nodes, and connections are kept in display lists and only rebuilt when something they depend on changes
+	// Display lists hold geometry in screen space, so every list depends on the transform and the size of the view
+	float view_xform[6];
+	nvgCurrentTransform(draw_context, view_xform);
+	std::uint64_t view_key = HASH_SEED;
+	hash_bytes(view_key, view_xform, sizeof(view_xform));
+	hash_value(view_key, px_ratio);
+	hash_value(view_key, widget_width);
+	hash_value(view_key, widget_height);
 
-		nvgStroke(draw_context);
-	}
+	// Grid
+	if (display_lists.replay_or_record(draw_context, &grid, view_key) == false) {
+		grid.draw(draw_context, Float2(borders.left, borders.top), Float2(borders.right, borders.bottom), zoom_scale, px_ratio);
+
+		// Dark lines at the origin
+		nvgStrokeWidth(draw_context, 2.75f);
+		nvgStrokeColor(draw_context, nvgRGBf(0.0f, 0.0f, 0.0f));
 
-	// Medium darkness lines
-	// Same as above but with 8 * grid size
-	{
-		const float MEDIUM_GRID_SIZE = GRID_SIZE_FL * 8;
 		nvgBeginPath(draw_context);
-		nvgStrokeWidth(draw_context, 1.8f);
-		nvgStrokeColor(draw_context, nvgRGBAf(0.0f, 0.0f, 0.0f, 0.45f));
-
-		// Horizontal
-		float next_line_y = floor(borders.top / MEDIUM_GRID_SIZE) * MEDIUM_GRID_SIZE;
-		while (next_line_y < borders.bottom) {
-			nvgMoveTo(draw_context, borders.left, next_line_y);
-			nvgLineTo(draw_context, borders.right, next_line_y);
-			next_line_y += MEDIUM_GRID_SIZE;
-		}
-		// Vertical
-		float next_line_x = floor(borders.left / MEDIUM_GRID_SIZE) * MEDIUM_GRID_SIZE;
-		while (next_line_x < borders.right) {
-			nvgMoveTo(draw_context, next_line_x, borders.top);
-			nvgLineTo(draw_context, next_line_x, borders.bottom);
-			next_line_x += MEDIUM_GRID_SIZE;
-		}
 
-		nvgStroke(draw_context);
-	}
+		nvgMoveTo(draw_context, 0.0f, borders.top);
+		nvgLineTo(draw_context, 0.0f, borders.bottom);
 
-	// Dark lines at the origin
-	nvgStrokeWidth(draw_context, 2.75f);
-	nvgStrokeColor(draw_context, nvgRGBf(0.0f, 0.0f, 0.0f));
+		nvgMoveTo(draw_context, borders.left, 0.0f);
+		nvgLineTo(draw_context, borders.right, 0.0f);
 
-	nvgBeginPath(draw_context);
+		nvgStroke(draw_context);
 
-	nvgMoveTo(draw_context, 0.0f, borders.top);
-	nvgLineTo(draw_context, 0.0f, borders.bottom);
+		display_lists.end_recording(draw_context);
+	}
 
-	nvgMoveTo(draw_context, borders.left, 0.0f);
-	nvgLineTo(draw_context, borders.right, 0.0f);
+	// Nodes and connections are only drawn if they overlap the visible area
+	const Area visible_area(Float2(borders.left, borders.top), Float2(borders.right, borders.bottom));
+	draw_counts = ViewDrawCounts();
 
-	nvgStroke(draw_context);
+	const DrawDetail detail = get_draw_detail(zoom_scale);
 
 	// Nodes
+	// Each node has its own list, so moving or editing one node only rebuilds that node
 	const std::shared_ptr<NodeSocket> selected_node = selection->socket.lock();
 	for (auto node_iterator = graph->nodes.rbegin(); node_iterator != graph->nodes.rend(); ++node_iterator) {
 		const std::shared_ptr<EditableNode> this_node = *node_iterator;
+		if (this_node->get_world_bounds().overlaps(visible_area) == false) {
+			draw_counts.nodes_culled++;
+			continue;
+		}
+		draw_counts.nodes_drawn++;
 		nvgSave(draw_context);
 		const float x = std::floor(this_node->world_pos.x);
 		const float y = std::floor(this_node->world_pos.y);
 		nvgTranslate(draw_context, x, y);
-		const bool node_selected = (selection->nodes.count(this_node) == 1);
-		this_node->draw_node(draw_context, node_selected, selected_node);
+
+		std::uint64_t node_key = view_key;
+		hash_value(node_key, x);
+		hash_value(node_key, y);
+		hash_value(node_key, detail);
+		std::uint64_t cache_key = 0;
+		const bool cached = (detail == DrawDetail::FULL) && node_cache->get_node_key(this_node.get(), cache_key);
+		if (cached) {
+			draw_counts.nodes_cached++;
+			hash_value(node_key, cache_key);
+		}
+		else {
+			hash_value(node_key, this_node->get_appearance_hash(this_node->selected, selected_node));
+		}
+
+		if (display_lists.replay_or_record(draw_context, this_node, node_key) == false) {
+			if (cached) {
+				node_cache->draw_node(draw_context, this_node.get());
+			}
+			else if (detail == DrawDetail::FULL) {
+				this_node->draw_node(draw_context, body_shapes, this_node->selected, selected_node);
+			}
+			else {
+				this_node->draw_node_simple(draw_context, body_shapes, this_node->selected);
+			}
+			display_lists.end_recording(draw_context);
+		}
 		nvgRestore(draw_context);
 	}
 
@@ -188,24 +217,95 @@ void cse::EditGraphView::draw(NVGcontext* draw_context)
 	}
 
 	// Connections
-	std::list<NodeConnection>::iterator connection_iter;
-	for (connection_iter = graph->connections.begin(); connection_iter != graph->connections.end(); ++connection_iter) {
-		NodeConnection this_connection = *connection_iter;
+	// All connections share one style, so they are added to a single path and stroked together
+	constexpr float CONNECTION_WIDTH = 2.0f;
+	class VisibleConnection {
+	public:
+		std::shared_ptr<NodeSocket> begin_socket;
+		std::shared_ptr<NodeSocket> end_socket;
+		Float2 begin_pos;
+		Float2 end_pos;
+	};
+	std::vector<VisibleConnection> visible_connections;
+	std::uint64_t connections_key = view_key;
+	hash_value(connections_key, detail);
+	for (const NodeConnection& this_connection : graph->connections) {
 		auto conn_begin = this_connection.begin_socket.lock();
 		auto conn_end = this_connection.end_socket.lock();
 		if (conn_begin && conn_end) {
-			Drawing::draw_node_connection_curve(draw_context, conn_begin->world_draw_position, conn_end->world_draw_position, 2.0f);
+			const Float2 begin_pos = conn_begin->get_world_position();
+			const Float2 end_pos = conn_end->get_world_position();
+			const Area curve_bounds = Drawing::get_node_connection_curve_bounds(begin_pos, end_pos, CONNECTION_WIDTH);
+			if (curve_bounds.overlaps(visible_area) == false) {
+				draw_counts.connections_culled++;
+				continue;
+			}
+			draw_counts.connections_drawn++;
+			hash_value(connections_key, begin_pos);
+			hash_value(connections_key, end_pos);
+			visible_connections.push_back(VisibleConnection{ conn_begin, conn_end, begin_pos, end_pos });
 		}
 	}
+	if (display_lists.replay_or_record(draw_context, &graph->connections, connections_key) == false) {
+		nvgBeginPath(draw_context);
+		for (const VisibleConnection& this_connection : visible_connections) {
+			if (detail == DrawDetail::MINIMAL) {
+				Drawing::add_node_connection_line(draw_context, this_connection.begin_pos, this_connection.end_pos);
+			}
+			else {
+				const std::vector<Float2>& curve_points = connection_curves.get_curve(
+					this_connection.begin_socket.get(),
+					this_connection.end_socket.get(),
+					this_connection.begin_pos,
+					this_connection.end_pos,
+					zoom_scale
+				);
+				Drawing::add_node_connection_polyline(draw_context, curve_points);
+			}
+		}
+		Drawing::stroke_node_connections(draw_context, CONNECTION_WIDTH);
+		display_lists.end_recording(draw_context);
+		// Curves are only requested when the list is rebuilt, so unused curves can only be found then
+		connection_curves.remove_unused();
+	}
 
 	// Connection in progress
 	if (const auto connection_start = connection_in_progress_start.lock()) {
-		Drawing::draw_node_connection_curve(draw_context, connection_start->world_draw_position, mouse_world_position, 3.2f);
+		Drawing::draw_node_connection_curve(draw_context, connection_start->get_world_position(), mouse_world_position, 3.2f);
 	}
 
+	draw_counts.lists_replayed = display_lists.get_replayed_count();
+	draw_counts.lists_recorded = display_lists.get_recorded_count();
+	display_lists.remove_unused();
+	draw_counts.bodies_tessellated = body_shapes.get_tessellated_count();
+	body_shapes.remove_unused();
+
 	nvgRestore(draw_context);
 }
 
+void cse::EditGraphView::prepare_draw(NVGcontext* const draw_context, const float new_px_ratio)
+{
+	px_ratio = new_px_ratio;
+
+	const float zoom_scale = zoom_level.get_world_scale();
+	if (get_draw_detail(zoom_scale) != DrawDetail::FULL) {
+		// The cache only holds fully detailed nodes
+		return;
+	}
+
+	// Only nodes that will be drawn this frame are rendered, this must match the culling in draw()
+	const ViewBorders borders(view_center, widget_width, widget_height, zoom_scale);
+	const Area visible_area(Float2(borders.left, borders.top), Float2(borders.right, borders.bottom));
+	std::vector<std::shared_ptr<EditableNode>> visible_nodes;
+	for (const auto& this_node : graph->nodes) {
+		if (this_node->get_world_bounds().overlaps(visible_area)) {
+			visible_nodes.push_back(this_node);
+		}
+	}
+
+	node_cache->update(draw_context, visible_nodes, zoom_scale, px_ratio, selection->socket.lock());
+}
+
 void cse::EditGraphView::handle_mouse_button(const int button, const int action, const int mods)
 {
 	const std::weak_ptr<EditableNode> weak_focused_node = graph->get_node_under_point(mouse_world_position);
@@ -266,7 +366,7 @@ void cse::EditGraphView::handle_mouse_button(const int button, const int action,
 				std::shared_ptr<EditableNode> new_node = locked_node_creation_helper->take();
 				if (new_node) {
 					graph->add_node(new_node, mouse_world_position);
-					selection->nodes.clear();
+					selection->clear_nodes();
 				}
 			}
 		}
@@ -300,7 +400,7 @@ void cse::EditGraphView::handle_key(const int key, int /*scancode*/, const int a
 {
 	const int delete_key = Platform::get_delete_key();
 	if (key == delete_key && action == GLFW_PRESS) {
-		graph->remove_node_set(selection->nodes);
+		graph->remove_node_set(selection->get_nodes());
 	}
 }
 
@@ -355,6 +455,11 @@ void cse::EditGraphView::clear_selection()
 	selection->clear();
 }
 
+bool cse::EditGraphView::is_interaction_active() const
+{
+	return mouse_pan_active || node_move_active || box_select_active;
+}
+
 std::string cse::EditGraphView::get_zoom_string() const
 {
 	constexpr unsigned char BUFFER_SIZE = 24;
@@ -367,6 +472,21 @@ std::string cse::EditGraphView::get_zoom_string() const
 	return std::string(buf);
 }
 
+std::string cse::EditGraphView::get_draw_counts_string() const
+{
+	// Built without a fixed size buffer since every count can be up to 10 digits
+	std::string result;
+	result += "Nodes: " + std::to_string(draw_counts.nodes_drawn) + " drawn, ";
+	result += std::to_string(draw_counts.nodes_cached) + " cached, ";
+	result += std::to_string(draw_counts.nodes_culled) + " culled  ";
+	result += "Connections: " + std::to_string(draw_counts.connections_drawn) + " drawn, ";
+	result += std::to_string(draw_counts.connections_culled) + " culled  ";
+	result += "Lists: " + std::to_string(draw_counts.lists_replayed) + " replayed, ";
+	result += std::to_string(draw_counts.lists_recorded) + " rebuilt  ";
+	result += "Bodies: " + std::to_string(draw_counts.bodies_tessellated) + " tessellated";
+	return result;
+}
+
 void cse::EditGraphView::begin_connection(const std::weak_ptr<NodeSocket> socket_begin)
 {
 	if (const auto socket_begin_ptr = socket_begin.lock()) {
@@ -468,25 +588,7 @@ void cse::EditGraphView::box_select_end(SelectMode mode)
 
 	WeakNodeSet boxed_nodes = get_boxed_nodes();
 
-	switch (mode) {
-	case SelectMode::NORMAL:
-		selection->nodes.clear();
-		selection->nodes.insert(boxed_nodes.begin(), boxed_nodes.end());
-		break;
-	case SelectMode::ADD:
-		selection->nodes.insert(boxed_nodes.begin(), boxed_nodes.end());
-		break;
-	case SelectMode::TOGGLE:
-		for (const auto& this_node : boxed_nodes) {
-			if (selection->nodes.count(this_node) == 1) {
-				selection->nodes.erase(this_node);
-			}
-			else {
-				selection->nodes.insert(this_node);
-			}
-		}
-		break;
-	}
+	selection->modify_selection(mode, boxed_nodes);
 
 	box_select_active = false;
 }
@@ -3,6 +3,10 @@
 #include <memory>
 #include <string>
 
+#include "connection_curve_cache.h"
+#include "display_list_cache.h"
+#include "grid_pattern.h"
+#include "node_body_shapes.h"
 #include "selection.h"
 #include "util_typedef.h"
 #include "util_vector.h"
@@ -14,6 +18,7 @@ namespace cse {
 
 	class EditableGraph;
 	class NodeCreationHelper;
+	class NodeRasterCache;
 	class NodeSocket;
 	class ViewUIRequests;
 
@@ -29,17 +34,37 @@ namespace cse {
 			const float bottom;
 		};
 
+		// Number of nodes and connections drawn or culled during the last call to draw()
+		class ViewDrawCounts {
+		public:
+			unsigned int nodes_drawn = 0;
+			// Nodes drawn from the raster cache, these are also counted in nodes_drawn
+			unsigned int nodes_cached = 0;
+			unsigned int nodes_culled = 0;
+			unsigned int connections_drawn = 0;
+			unsigned int connections_culled = 0;
+			// Display lists for the grid, nodes, and connections
+			unsigned int lists_replayed = 0;
+			unsigned int lists_recorded = 0;
+			// Node body shapes tessellated, every other body drawn reused one of these
+			unsigned int bodies_tessellated = 0;
+		};
+
 	public:
 		EditGraphView(
 			std::shared_ptr<EditableGraph> graph,
 			std::weak_ptr<NodeCreationHelper> node_creation_helper
 		);
+		~EditGraphView();
 
 		// Main 3 functions called from the main loop
 		void set_mouse_position(Float2 view_local_mouse_pos, int viewport_width, int viewport_height);
 		void pre_draw();
 		void draw(NVGcontext* draw_context);
 
+		// Work that must happen before the frame containing draw() begins, such as rendering changed nodes into the node cache
+		void prepare_draw(NVGcontext* draw_context, float px_ratio);
+
 		// Input
 		void handle_mouse_button(int button, int action, int mods);
 		void handle_key(int key, int scancode, int action, int mods);
@@ -48,12 +73,16 @@ namespace cse {
 		// Undo
 		bool needs_undo_push();
 
+		// True while the user is panning, moving nodes, or box selecting
+		bool is_interaction_active() const;
+
 		// Selection
 		std::weak_ptr<const Selection> get_const_selection() const;
 		void clear_selection();
 
 		// Misc
 		std::string get_zoom_string() const;
+		std::string get_draw_counts_string() const;
 
 	private:
 		void begin_connection(std::weak_ptr<NodeSocket> socket_begin);
@@ -91,6 +120,14 @@ namespace cse {
 
 		Float2 view_center;
 
+		ViewDrawCounts draw_counts;
+
+		std::unique_ptr<NodeRasterCache> node_cache;
+		ConnectionCurveCache connection_curves;
+		DisplayListCache display_lists;
+		NodeBodyShapes body_shapes;
+		GridPattern grid;
+
 		Float2 mouse_world_position;
 		bool mouse_pan_active = false;
 
@@ -102,6 +139,8 @@ namespace cse {
 		// Width and height of this view widget, in pixels on screen
 		int widget_width;
 		int widget_height;
+		// Ratio of framebuffer pixels to screen pixels
+		float px_ratio = 1.0f;
 	};
 
 }
@@ -31,7 +31,7 @@ void cse::RadioListWidget::attach_value(const std::weak_ptr<StringEnumSocketValu
 	this->attached_bool = std::weak_ptr<BoolSocketValue>();
 	if (auto locked = enum_socket_value.lock()) {
 		this->attached_enum = locked;
-		for (const StringEnumPair& this_pair : locked->enum_values) {
+		for (const StringEnumPair& this_pair : *(locked->enum_values)) {
 			string_pairs.push_back(this_pair);
 		}
 	}
@@ -30,6 +30,14 @@ namespace cse {
 		return glfwSetScrollCallback(glfw_window->window_ptr, cbfun);
 	}
 
+	// Window callback setup
+	inline GLFWwindowrefreshfun glfwSetWindowRefreshCallback(const std::unique_ptr<GlfwWindow>& glfw_window, const GLFWwindowrefreshfun cbfun) {
+		return glfwSetWindowRefreshCallback(glfw_window->window_ptr, cbfun);
+	}
+	inline GLFWwindowfocusfun glfwSetWindowFocusCallback(const std::unique_ptr<GlfwWindow>& glfw_window, const GLFWwindowfocusfun cbfun) {
+		return glfwSetWindowFocusCallback(glfw_window->window_ptr, cbfun);
+	}
+
 	// Window status
 	inline int glfwWindowShouldClose(const std::unique_ptr<GlfwWindow>& glfw_window) {
 		return glfwWindowShouldClose(glfw_window->window_ptr);
@@ -43,6 +51,9 @@ namespace cse {
 	inline void glfwGetWindowSize(const std::unique_ptr<GlfwWindow>& glfw_window, int* const width, int* const height) {
 		glfwGetWindowSize(glfw_window->window_ptr, width, height);
 	}
+	inline int glfwGetWindowAttrib(const std::unique_ptr<GlfwWindow>& glfw_window, const int attrib) {
+		return glfwGetWindowAttrib(glfw_window->window_ptr, attrib);
+	}
 
 	// OpenGL stuff
 	inline void glfwSwapBuffers(const std::unique_ptr<GlfwWindow>& glfw_window) {
@@ -5,8 +5,13 @@
 #include <GL/glew.h>
 #include <nanovg_gl.h>
 
+// nanovg only enables its framebuffer helpers for OpenGL 2 on macOS
+// GLEW provides the framebuffer functions everywhere, support is checked at runtime before they are used
+#define NANOVG_FBO_VALID 1
+#include <nanovg_gl_utils.h>
+
 cse::NvgContext::NvgContext() :
-	context_ptr(nvgCreateGL2(NVG_ANTIALIAS | NVG_STENCIL_STROKES | NVG_DEBUG))
+	context_ptr(nvgCreateGL2(NVG_ANTIALIAS | NVG_STENCIL_STROKES | NVG_SDF_TEXT | NVG_DEBUG))
 {
 
 }
@@ -21,3 +26,26 @@ cse::NvgContext::~NvgContext()
 bool cse::NvgContext::is_valid() const {
 	return (context_ptr != nullptr);
 }
+
+cse::NvgDrawStats cse::NvgContext::get_draw_stats() const
+{
+	NvgDrawStats result;
+	if (context_ptr == nullptr) {
+		return result;
+	}
+
+	NVGglStats stats;
+	nvglGetStatsGL2(context_ptr, &stats);
+	result.calls = stats.calls;
+	result.batches = stats.batches;
+	result.gl_draw_calls = stats.drawCalls;
+	result.uniform_uploads = stats.uniformUploads;
+	return result;
+}
+
+void cse::NvgContext::reset_draw_stats()
+{
+	if (context_ptr != nullptr) {
+		nvglResetStatsGL2(context_ptr);
+	}
+}
@@ -4,6 +4,17 @@ struct NVGcontext;
 
 namespace cse {
 
+	// Submission totals from the OpenGL nanovg back-end
+	class NvgDrawStats {
+	public:
+		// Fill, stroke and text calls made through nanovg
+		int calls = 0;
+		// Calls left after neighbours with the same paint and blend state were merged
+		int batches = 0;
+		int gl_draw_calls = 0;
+		int uniform_uploads = 0;
+	};
+
 	// Class to safely wrap nvgCreate and nvgDelete
 	class NvgContext {
 	public:
@@ -12,6 +23,10 @@ namespace cse {
 
 		bool is_valid() const;
 
+		// Totals for everything flushed since the last call to reset_draw_stats
+		NvgDrawStats get_draw_stats() const;
+		void reset_draw_stats();
+
 		NVGcontext* const context_ptr;
 	};
 }
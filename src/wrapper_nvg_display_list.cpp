@@ -0,0 +1,21 @@
+#include "wrapper_nvg_display_list.h"
+
+#include <nanovg.h>
+
+cse::NvgDisplayList::NvgDisplayList() :
+	list_ptr(nvgCreateDisplayList())
+{
+
+}
+
+cse::NvgDisplayList::~NvgDisplayList()
+{
+	if (list_ptr != nullptr) {
+		nvgDeleteDisplayList(list_ptr);
+	}
+}
+
+bool cse::NvgDisplayList::is_valid() const
+{
+	return (list_ptr != nullptr);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+struct NVGdisplayList;
+
+namespace cse {
+
+	// Class to safely wrap nvgCreateDisplayList and nvgDeleteDisplayList
+	class NvgDisplayList {
+	public:
+		NvgDisplayList();
+		~NvgDisplayList();
+
+		bool is_valid() const;
+
+		NVGdisplayList* const list_ptr;
+	};
+}
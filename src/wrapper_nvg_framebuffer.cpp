@@ -0,0 +1,70 @@
+#include "wrapper_nvg_framebuffer.h"
+
+#include <GL/glew.h>
+#include <nanovg.h>
+#include <nanovg_gl_utils.h>
+
+static NVGLUframebuffer* create_framebuffer(NVGcontext* const context, const int width, const int height, const int image_flags)
+{
+	// Framebuffer objects are not part of OpenGL 2, so only try to create one if the driver supports them
+	if (GLEW_VERSION_3_0 || GLEW_ARB_framebuffer_object) {
+		return nvgluCreateFramebuffer(context, width, height, image_flags);
+	}
+	return nullptr;
+}
+
+cse::NvgFramebuffer::NvgFramebuffer(NVGcontext* const context, const int width, const int height, const int image_flags) :
+	width(width),
+	height(height),
+	framebuffer_ptr(create_framebuffer(context, width, height, image_flags))
+{
+
+}
+
+cse::NvgFramebuffer::~NvgFramebuffer()
+{
+	if (framebuffer_ptr != nullptr) {
+		nvgluDeleteFramebuffer(framebuffer_ptr);
+	}
+}
+
+bool cse::NvgFramebuffer::is_valid() const
+{
+	return (framebuffer_ptr != nullptr);
+}
+
+void cse::NvgFramebuffer::bind()
+{
+	nvgluBindFramebuffer(framebuffer_ptr);
+	glViewport(0, 0, width, height);
+}
+
+void cse::NvgFramebuffer::unbind()
+{
+	nvgluBindFramebuffer(nullptr);
+}
+
+void cse::NvgFramebuffer::clear_region(const int x, const int y, const int region_width, const int region_height)
+{
+	// OpenGL puts the origin at the bottom left
+	const int gl_y = height - y - region_height;
+
+	GLfloat old_clear_color[4];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, old_clear_color);
+
+	glEnable(GL_SCISSOR_TEST);
+	glScissor(x, gl_y, region_width, region_height);
+	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+	glDisable(GL_SCISSOR_TEST);
+
+	glClearColor(old_clear_color[0], old_clear_color[1], old_clear_color[2], old_clear_color[3]);
+}
+
+int cse::NvgFramebuffer::get_image() const
+{
+	if (framebuffer_ptr == nullptr) {
+		return -1;
+	}
+	return framebuffer_ptr->image;
+}
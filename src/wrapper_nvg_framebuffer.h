@@ -0,0 +1,33 @@
+#pragma once
+
+struct NVGcontext;
+struct NVGLUframebuffer;
+
+namespace cse {
+
+	// Class to safely wrap nvgluCreateFramebuffer and nvgluDeleteFramebuffer
+	class NvgFramebuffer {
+	public:
+		NvgFramebuffer(NVGcontext* context, int width, int height, int image_flags);
+		~NvgFramebuffer();
+
+		bool is_valid() const;
+
+		// Directs all drawing to this framebuffer and sets the viewport to cover it
+		void bind();
+		// Directs drawing back to the window, the caller is responsible for restoring the viewport
+		static void unbind();
+
+		// Clears a rectangle to transparent black, coordinates are in pixels with the origin at the top left
+		void clear_region(int x, int y, int width, int height);
+
+		// nanovg image handle for this framebuffer's color attachment
+		int get_image() const;
+
+		const int width;
+		const int height;
+
+	private:
+		NVGLUframebuffer* const framebuffer_ptr;
+	};
+}
@@ -0,0 +1,51 @@
+#include "wrapper_nvg_recording_context.h"
+
+#define NANOVG_REC_IMPLEMENTATION
+
+#include <nanovg.h>
+#include <nanovg_rec.h>
+
+// Flags match NvgContext so text goes through the same distance field path as the editor
+cse::NvgRecordingContext::NvgRecordingContext() :
+	context_ptr(nvgCreateRec(NVG_REC_ANTIALIAS | NVG_REC_SDF_TEXT))
+{
+
+}
+
+cse::NvgRecordingContext::~NvgRecordingContext()
+{
+	if (context_ptr != nullptr) {
+		nvgDeleteRec(context_ptr);
+	}
+}
+
+bool cse::NvgRecordingContext::is_valid() const
+{
+	return (context_ptr != nullptr);
+}
+
+cse::NvgRecordingStats cse::NvgRecordingContext::get_stats() const
+{
+	NvgRecordingStats result;
+	if (context_ptr == nullptr) {
+		return result;
+	}
+
+	NVGrecStats stats;
+	nvgRecGetStats(context_ptr, &stats);
+	result.fills = stats.fills;
+	result.strokes = stats.strokes;
+	result.text_runs = stats.triangles;
+	result.paths = stats.paths;
+	result.vertices = stats.verts;
+	result.frames = stats.frames;
+	result.texture_updates = stats.textureUpdates;
+	return result;
+}
+
+void cse::NvgRecordingContext::clear()
+{
+	if (context_ptr != nullptr) {
+		nvgRecClear(context_ptr);
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+struct NVGcontext;
+
+namespace cse {
+
+	// Per-frame totals from the recording nanovg back-end
+	class NvgRecordingStats {
+	public:
+		int fills = 0;
+		int strokes = 0;
+		// Each text run is submitted as one set of triangles
+		int text_runs = 0;
+		int paths = 0;
+		int vertices = 0;
+		int frames = 0;
+		int texture_updates = 0;
+	};
+
+	// Class to safely wrap nvgCreateRec and nvgDeleteRec
+	// The context draws nothing, it only counts what would have been drawn so drawing code can be measured without a GPU
+	class NvgRecordingContext {
+	public:
+		NvgRecordingContext();
+		~NvgRecordingContext();
+
+		bool is_valid() const;
+
+		// Totals for everything drawn since the last call to clear
+		NvgRecordingStats get_stats() const;
+		void clear();
+
+		NVGcontext* const context_ptr;
+	};
+}
@@ -0,0 +1,21 @@
+#include "wrapper_nvg_shape.h"
+
+#include <nanovg.h>
+
+cse::NvgShape::NvgShape() :
+	shape_ptr(nvgCreateShape())
+{
+
+}
+
+cse::NvgShape::~NvgShape()
+{
+	if (shape_ptr != nullptr) {
+		nvgDeleteShape(shape_ptr);
+	}
+}
+
+bool cse::NvgShape::is_valid() const
+{
+	return (shape_ptr != nullptr);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+struct NVGshape;
+
+namespace cse {
+
+	// Class to safely wrap nvgCreateShape and nvgDeleteShape
+	class NvgShape {
+	public:
+		NvgShape();
+		~NvgShape();
+
+		bool is_valid() const;
+
+		NVGshape* const shape_ptr;
+	};
+}
@@ -38,6 +38,11 @@ float cse::ZoomManager::get_world_scale() const
 	return zooms[zoom_level];
 }
 
+const std::vector<float>& cse::ZoomManager::get_world_scales() const
+{
+	return zooms;
+}
+
 void cse::ZoomManager::zoom_in()
 {
 	if (zoom_level == static_cast<int>(zooms.size() - 1)) {
@@ -9,6 +9,7 @@ namespace cse {
 		ZoomManager();
 
 		float get_world_scale() const;
+		const std::vector<float>& get_world_scales() const;
 
 		void zoom_in();
 		void zoom_out();